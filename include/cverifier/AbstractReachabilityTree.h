@@ -0,0 +1,108 @@
+#ifndef CVERIFIER_ABSTRACT_REACHABILITY_TREE_H
+#define CVERIFIER_ABSTRACT_REACHABILITY_TREE_H
+
+#include "cverifier/CFG.h"
+#include "cverifier/SymbolicState.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 抽象可达树（惰性抽象）
+// ============================================================================
+
+/**
+ * @brief 抽象可达树的节点：从入口到 location 的一条 CFG 路径
+ *
+ * 标签是程序变量当前值上的公式（变量名与符号存储中的名字一致），
+ * 沿这条路径到达 location 的每个状态都满足它
+ */
+struct ArtNode {
+    CFGNode* location = nullptr;
+    ArtNode* parent = nullptr;
+    size_t succIndex = 0;          ///< 在父节点位置的后继中的序号
+    size_t id = 0;                 ///< 创建顺序，只能被更早的节点覆盖
+    size_t depth = 0;
+    Expr* label = nullptr;         ///< 标签（空表示恒真）
+    bool refuted = false;          ///< 标签不可满足：这条路径不可行
+    bool expanded = false;
+    ArtNode* coveredBy = nullptr;
+    std::vector<ArtNode*> children;
+};
+
+/**
+ * @brief 路径上一个节点处的基本块从全自由的状态执行的效果
+ */
+struct ArtStep {
+    Expr* condition = nullptr;   ///< 指令附加的约束和走向路径下一个节点的分支约束（空表示恒真）
+    std::unordered_map<std::string, Expr*> bindings;   ///< 执行后的变量值（以块入口的值表示）
+};
+
+/**
+ * @brief 抽象可达树（IMPACT）
+ *
+ * 节点 v 被 w 覆盖：两者位置相同，w 更早创建且未被覆盖，v 的标签蕴含 w 的标签。
+ * 被覆盖的节点及其后代不再展开，它们能到达的状态都由 w 的子树代表。
+ * 树只负责结构和覆盖关系的维护，蕴含检查由调用者完成。
+ */
+class AbstractReachabilityTree {
+public:
+    explicit AbstractReachabilityTree(CFGNode* root);
+
+    ArtNode* getRoot() const { return nodes_.front().get(); }
+
+    /**
+     * @brief 为 parent 创建位置为 location 的子节点（标签为恒真）
+     */
+    ArtNode* addChild(ArtNode* parent, CFGNode* location, size_t succIndex);
+
+    /**
+     * @brief 从根到 node 的路径（包括两端）
+     */
+    std::vector<ArtNode*> pathTo(ArtNode* node) const;
+
+    /**
+     * @brief 同一位置上的节点（按创建顺序）
+     */
+    const std::vector<ArtNode*>& nodesAt(const CFGNode* location) const;
+
+    /**
+     * @brief 节点或它的某个祖先被覆盖
+     */
+    bool isCovered(const ArtNode* node) const;
+
+    /**
+     * @brief 记录 node 被 by 覆盖
+     *
+     * node 的后代不再能作为覆盖者，被它们覆盖的节点解除覆盖
+     * @param uncovered 输出：重新需要处理的节点
+     */
+    void cover(ArtNode* node, ArtNode* by, std::vector<ArtNode*>& uncovered);
+
+    /**
+     * @brief 标签被加强后，解除被 node 覆盖的节点的覆盖关系
+     * @param uncovered 输出：重新需要处理的节点
+     */
+    void uncoverBy(ArtNode* node, std::vector<ArtNode*>& uncovered);
+
+    size_t size() const { return nodes_.size(); }
+
+    /**
+     * @brief 当前被覆盖的节点数
+     */
+    size_t getNumCovered() const;
+
+private:
+    std::vector<std::unique_ptr<ArtNode>> nodes_;
+    std::unordered_map<const CFGNode*, std::vector<ArtNode*>> byLocation_;
+    std::unordered_map<const ArtNode*, std::vector<ArtNode*>> coveredNodes_;  ///< 覆盖者 -> 被覆盖的节点
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_ABSTRACT_REACHABILITY_TREE_H
@@ -0,0 +1,114 @@
+#ifndef CVERIFIER_BLOCK_TRANSFER_CACHE_H
+#define CVERIFIER_BLOCK_TRANSFER_CACHE_H
+
+#include "cverifier/LLIRModule.h"
+#include "cverifier/SymbolicState.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 基本块转移缓存
+// ============================================================================
+
+/**
+ * @brief 单条指令的符号效果
+ *
+ * 表达式和名称中可能出现两类占位符：块的活跃输入（liveIns 中的
+ * VariableExpr 对象，按指针识别）和新鲜符号（名称以
+ * BlockTransferCache::freshPlaceholder() 开头）
+ */
+struct InstructionEffect {
+    std::vector<std::pair<std::string, Expr*>> liveIns;      ///< 本指令首次读取的存储名及其占位符
+    std::vector<std::pair<std::string, Expr*>> assignments;  ///< 存储更新（按名称排序）
+    std::vector<Expr*> constraints;                          ///< 新增的路径约束
+};
+
+/**
+ * @brief 基本块的参数化转移摘要
+ *
+ * 覆盖终结指令（br/ret）之前的所有指令。这些指令的效果只取决于块入口处
+ * 被读取的存储单元的值，所以可以在一个空的模板状态上执行一次，之后每次
+ * 访问只需把占位符替换为实际值。
+ */
+struct BlockTransfer {
+    size_t numFresh = 0;                     ///< 每次执行消耗的新鲜符号数
+    std::vector<InstructionEffect> effects;  ///< 每条非终结指令的效果
+};
+
+/**
+ * @brief 一次实例化中的占位符替换
+ *
+ * 未改变的子表达式原样共享，只为包含占位符的部分分配新节点
+ */
+class TransferSubstitution {
+public:
+    /**
+     * @brief 绑定活跃输入的占位符
+     */
+    void bindLiveIn(const Expr* placeholder, Expr* value) {
+        memo_[placeholder] = value;
+    }
+
+    /**
+     * @brief 追加下一个新鲜符号的实际名称（按占位符序号顺序）
+     */
+    void addFreshName(const std::string& name) {
+        freshNames_.push_back(name);
+    }
+
+    Expr* apply(Expr* expr);
+    std::string applyName(const std::string& name) const;
+
+private:
+    std::unordered_map<const Expr*, Expr*> memo_;
+    std::vector<std::string> freshNames_;
+};
+
+/**
+ * @brief 基本块转移摘要缓存
+ *
+ * 以基本块为键。指令结果名在模块生命周期内稳定，所以摘要可以跨函数、
+ * 跨挂起恢复复用。
+ */
+class BlockTransferCache {
+public:
+    /**
+     * @brief 查找块的摘要
+     * @param known 块是否已经分析过（包括不可缓存的块）
+     * @return 可缓存时返回摘要，否则返回 nullptr
+     */
+    const BlockTransfer* lookup(const LLIRBasicBlock* bb, bool& known) const;
+
+    /**
+     * @brief 记录块的摘要（transfer 为空表示块不可缓存）
+     */
+    const BlockTransfer* insert(const LLIRBasicBlock* bb, std::unique_ptr<BlockTransfer> transfer);
+
+    /**
+     * @brief 第 index 个新鲜符号的占位名
+     */
+    static std::string freshPlaceholder(size_t index);
+
+    void recordHit() { ++hits_; }
+
+    std::string getStatistics() const;
+
+private:
+    std::unordered_map<const LLIRBasicBlock*, std::unique_ptr<BlockTransfer>> transfers_;
+
+    // 统计
+    size_t hits_ = 0;
+    size_t summarized_ = 0;
+    size_t uncacheable_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_BLOCK_TRANSFER_CACHE_H
@@ -125,6 +125,7 @@ public:
 
     /**
      * @brief 找到所有回边（用于循环检测）
+     * @return (回边源, 循环头) 列表
      */
     std::vector<std::pair<CFGNode*, CFGNode*>> findBackEdges() const;
 
@@ -139,7 +140,7 @@ public:
     int computeDepth(CFGNode* node) const;
 
     /**
-     * @brief 获取所有循环（自然循环）
+     * @brief 获取所有循环（自然循环，每个回边一个，第一个节点是循环头）
      */
     std::vector<std::vector<CFGNode*>> findLoops() const;
 
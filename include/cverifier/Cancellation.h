@@ -0,0 +1,102 @@
+#ifndef CVERIFIER_CANCELLATION_H
+#define CVERIFIER_CANCELLATION_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 协作式取消
+// ============================================================================
+
+/**
+ * @brief 取消令牌
+ *
+ * 由引擎持有，任意线程调用 cancel() 后：
+ * - 探索循环在下一次迭代时退出
+ * - 所有已注册的中断处理器（例如正在运行的 Z3 查询）立即被调用
+ */
+class CancellationToken {
+public:
+    using InterruptHandler = std::function<void()>;
+
+    CancellationToken() = default;
+
+    // 禁止拷贝
+    CancellationToken(const CancellationToken&) = delete;
+    CancellationToken& operator=(const CancellationToken&) = delete;
+
+    /**
+     * @brief 请求取消并触发所有中断处理器
+     */
+    void cancel();
+
+    /**
+     * @brief 是否已请求取消
+     */
+    bool isCancelled() const {
+        return cancelled_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 清除取消标记（用于复用引擎）
+     */
+    void reset() {
+        cancelled_.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief 注册中断处理器
+     * @return 用于注销的句柄
+     *
+     * 如果令牌已被取消，处理器会被立即调用一次
+     */
+    size_t addInterruptHandler(InterruptHandler handler);
+
+    /**
+     * @brief 注销中断处理器
+     *
+     * 返回后保证该处理器不会再被调用
+     */
+    void removeInterruptHandler(size_t handle);
+
+    /**
+     * @brief 获取当前线程上生效的令牌（可能为空）
+     *
+     * 在引擎内部新建的求解器通过它自动接入取消机制
+     */
+    static CancellationToken* current();
+
+private:
+    friend class CancellationScope;
+
+    std::atomic<bool> cancelled_{false};
+    std::mutex mutex_;
+    std::unordered_map<size_t, InterruptHandler> handlers_;
+    size_t nextHandle_ = 1;
+};
+
+/**
+ * @brief 在作用域内把令牌设为当前线程的令牌（RAII）
+ */
+class CancellationScope {
+public:
+    explicit CancellationScope(CancellationToken* token);
+    ~CancellationScope();
+
+    CancellationScope(const CancellationScope&) = delete;
+    CancellationScope& operator=(const CancellationScope&) = delete;
+
+private:
+    CancellationToken* previous_;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_CANCELLATION_H
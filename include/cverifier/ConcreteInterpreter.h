@@ -0,0 +1,62 @@
+#ifndef CVERIFIER_CONCRETE_INTERPRETER_H
+#define CVERIFIER_CONCRETE_INTERPRETER_H
+
+#include "cverifier/LLIRModule.h"
+#include "cverifier/NativeExecutor.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 具体解释执行
+// ============================================================================
+
+/**
+ * @brief LLIR 的具体解释器
+ *
+ * 语义与 NativeExecutor 完全相同（见 NativeExecutor.h），结果可以互换；
+ * 不依赖 LLVM，JIT 后端不可用时作为替代。函数第一次执行时被预编译为按槽位
+ * 寻址的指令序列，之后每次执行不再查找名字。
+ */
+class ConcreteInterpreter {
+public:
+    explicit ConcreteInterpreter(LLIRModule* module);
+    ~ConcreteInterpreter();
+
+    ConcreteInterpreter(const ConcreteInterpreter&) = delete;
+    ConcreteInterpreter& operator=(const ConcreteInterpreter&) = delete;
+
+    /**
+     * @brief 以给定输入执行函数
+     * @param maxBranches 执行的分支指令数上限
+     * @return 函数不存在时 completed 为 false
+     */
+    ConcreteResult run(
+        const std::string& functionName,
+        const std::unordered_map<std::string, int64_t>& inputs,
+        size_t maxBranches = 100000
+    );
+
+    /**
+     * @brief 可能影响执行的输入名（参数、全局变量、被读取的存储单元、
+     * 不计算的指令结果），按名字排序
+     */
+    std::vector<std::string> getInputNames(const std::string& functionName);
+
+private:
+    struct Program;   ///< 预编译的函数
+
+    Program* prepare(const std::string& functionName);
+
+    LLIRModule* module_;
+    std::unordered_map<std::string, std::unique_ptr<Program>> programs_;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_CONCRETE_INTERPRETER_H
@@ -0,0 +1,69 @@
+#ifndef CVERIFIER_EDGE_COVERAGE_H
+#define CVERIFIER_EDGE_COVERAGE_H
+
+#include "cverifier/CFG.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 边覆盖
+// ============================================================================
+
+/**
+ * @brief 函数的 CFG 边覆盖位图（AFL 风格）
+ *
+ * 边按基本块顺序和后继顺序编号，编号 0 是进入函数入口的虚拟边。
+ * 位图每项是饱和到 255 的命中计数；一次转移第一次命中某条边时
+ * 记为新覆盖。基本块覆盖由入边推出：块被覆盖当且仅当它有入边被覆盖。
+ */
+class EdgeCoverage {
+public:
+    explicit EdgeCoverage(CFG* cfg);
+
+    /**
+     * @brief 记录一次转移
+     * @param from 前驱节点（nullptr 表示进入函数入口）
+     * @return 是否第一次走过这条边
+     */
+    bool visit(const CFGNode* from, const CFGNode* to);
+
+    /**
+     * @brief 这条转移是否已经走过（不在 CFG 中的转移视为已覆盖）
+     */
+    bool isCovered(const CFGNode* from, const CFGNode* to) const;
+
+    /**
+     * @brief 按编号标记边已覆盖（fork 子进程发回的结果）
+     */
+    void markEdge(size_t edge);
+
+    /**
+     * @brief 已覆盖边的编号（编号只在同一个 CFG 上有意义）
+     */
+    std::vector<size_t> getCoveredEdges() const;
+
+    size_t getNumEdges() const { return bitmap_.size(); }
+    size_t getNumCoveredEdges() const { return coveredEdges_; }
+    size_t getNumBlocks() const { return blockHits_.size(); }
+    size_t getNumCoveredBlocks() const { return coveredBlocks_; }
+
+private:
+    bool edgeIndex(const CFGNode* from, const CFGNode* to, size_t& edge) const;
+
+    std::unordered_map<const CFGNode*, size_t> firstEdge_;   ///< 节点第一条出边的编号
+    std::unordered_map<const CFGNode*, size_t> blockIndex_;
+    std::vector<size_t> edgeTarget_;   ///< 边编号 -> 目标块序号
+    std::vector<uint8_t> bitmap_;      ///< 边命中计数（饱和）
+    std::vector<uint8_t> blockHits_;   ///< 块是否被覆盖
+    size_t coveredEdges_ = 0;
+    size_t coveredBlocks_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_EDGE_COVERAGE_H
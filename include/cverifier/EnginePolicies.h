@@ -0,0 +1,216 @@
+#ifndef CVERIFIER_ENGINE_POLICIES_H
+#define CVERIFIER_ENGINE_POLICIES_H
+
+#include "cverifier/SymbolicState.h"
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace cverifier {
+namespace core {
+
+struct ExplorationState;
+class EdgeCoverage;
+
+/// 探索前沿：两端都可以取出，由搜索策略决定取哪个状态
+using Worklist = std::deque<ExplorationState*>;
+
+// ============================================================================
+// 搜索策略
+// ============================================================================
+//
+// 搜索策略和求解方式是编译期策略类：探索主循环是以它们为参数的模板，
+// 每种组合实例化一份，select()/kCached 在循环中被内联，没有虚调用。
+// 引擎根据配置在运行期选择预先实例化好的组合。
+
+/**
+ * @brief 多臂老虎机元策略的运行期状态（每个函数重新学习）
+ */
+struct BanditState {
+    static constexpr size_t kNumArms = 4;
+
+    size_t arm = 0;                   ///< 当前时间片使用的子策略
+    bool inSlice = false;
+    size_t sliceSelections = 0;       ///< 当前时间片已做的选择数
+    size_t sliceRewards = 0;          ///< 时间片开始时的累计收益
+    std::chrono::steady_clock::time_point sliceStart;
+    double meanRate[kNumArms] = {};   ///< 各子策略单位时间收益的平均值
+    size_t slices[kNumArms] = {};     ///< 各子策略用过的时间片数
+    size_t totalSlices = 0;
+    size_t usedSlices[kNumArms] = {}; ///< 各子策略累计的时间片数（跨函数，只用于统计）
+
+    /// 开始新函数：清空学到的收益率，保留累计统计
+    void restart() {
+        inSlice = false;
+        totalSlices = 0;
+        for (size_t arm = 0; arm < kNumArms; ++arm) {
+            meanRate[arm] = 0.0;
+            slices[arm] = 0;
+        }
+    }
+};
+
+/**
+ * @brief 搜索策略的运行期状态，由引擎持有
+ */
+struct SearchContext {
+    std::mt19937 rng{0};   ///< 固定种子：同样的输入得到同样的随机顺序
+    size_t selections = 0;
+    const EdgeCoverage* coverage = nullptr;  ///< 当前函数的边覆盖
+    bool deterministic = false;   ///< 时间按选择次数计量，不读墙钟
+    size_t rewards = 0;           ///< 引擎累计的收益：新覆盖的边数与新报告数之和
+    BanditState bandit;
+};
+
+/**
+ * @brief 深度优先：取最近加入的状态
+ */
+struct DfsSearcher {
+    static ExplorationState* select(Worklist& worklist, SearchContext&) {
+        ExplorationState* state = worklist.back();
+        worklist.pop_back();
+        return state;
+    }
+};
+
+/**
+ * @brief 广度优先：取最早加入的状态
+ */
+struct BfsSearcher {
+    static ExplorationState* select(Worklist& worklist, SearchContext&) {
+        ExplorationState* state = worklist.front();
+        worklist.pop_front();
+        return state;
+    }
+};
+
+/**
+ * @brief 混合策略：以深度优先为主，定期取一个最浅的状态，避免困在单条深路径上
+ */
+struct HybridSearcher {
+    static constexpr size_t kBreadthPeriod = 8;
+
+    static ExplorationState* select(Worklist& worklist, SearchContext& context) {
+        if (++context.selections % kBreadthPeriod == 0) {
+            return BfsSearcher::select(worklist, context);
+        }
+        return DfsSearcher::select(worklist, context);
+    }
+};
+
+/**
+ * @brief 随机搜索：均匀地取任意一个状态
+ */
+struct RandomSearcher {
+    static ExplorationState* select(Worklist& worklist, SearchContext& context) {
+        std::uniform_int_distribution<size_t> pick(0, worklist.size() - 1);
+        std::swap(worklist[pick(context.rng)], worklist.back());
+        return DfsSearcher::select(worklist, context);
+    }
+};
+
+/**
+ * @brief 覆盖引导：优先取将要走过未覆盖边的状态（从最近加入的开始查看
+ *        kScanWindow 个），没有时按深度优先
+ */
+struct CoverageSearcher {
+    static constexpr size_t kScanWindow = 256;
+
+    static ExplorationState* select(Worklist& worklist, SearchContext& context);
+};
+
+/**
+ * @brief 多臂老虎机元策略：在深度优先、广度优先、随机和覆盖引导之间分配时间片
+ *
+ * 时间片结束时，子策略的收益率是这段时间内新覆盖的边数与新报告数之和除以
+ * 所用时间；下一个时间片交给 UCB1 上置信界最大的子策略，收益率高的多用，
+ * 用得少的也会定期再试。时间片为 kSliceMs 毫秒墙钟；确定性模式下改为
+ * kSliceSelections 次选择，收益率按选择次数计算，与机器负载无关。
+ */
+struct BanditSearcher {
+    static constexpr double kSliceMs = 50.0;
+    static constexpr size_t kSliceSelections = 32;
+    static constexpr const char* kArmNames[BanditState::kNumArms] = {"DFS", "BFS", "Random", "Coverage"};
+
+    static ExplorationState* select(Worklist& worklist, SearchContext& context);
+
+    static std::string getStatistics(const SearchContext& context);
+};
+
+// ============================================================================
+// 求解方式
+// ============================================================================
+
+/**
+ * @brief 每次可行性检查都交给求解器
+ */
+struct DirectSolver {
+    static constexpr bool kCached = false;
+};
+
+/**
+ * @brief 先查可行性缓存，未命中才交给求解器
+ */
+struct CachedSolver {
+    static constexpr bool kCached = true;
+};
+
+/**
+ * @brief 路径约束可行性缓存
+ *
+ * 键是约束集合的结构指纹（PathConstraint::getFingerprint）：同一条件在
+ * 路径上重复出现、或不同路径以不同顺序得到同一组约束时，直接复用之前的
+ * 结论。每个条目另存去重后的约束个数和一个独立的哈希组合，指纹碰撞时
+ * 不会误用别的约束集合的结论。条目数达到 kMaxEntries 时整体清空。
+ * Unknown 按可满足记录，与不剪枝的保守处理一致。
+ */
+class FeasibilityCache {
+public:
+    /**
+     * @brief 查找约束集合的结论
+     * @return 命中时返回 true，结论写入 satisfiable
+     */
+    bool lookup(const PathConstraint& constraint, bool& satisfiable);
+
+    void insert(const PathConstraint& constraint, bool satisfiable);
+
+    std::string getStatistics() const;
+
+    static constexpr size_t kMaxEntries = 1 << 16;
+
+private:
+    /**
+     * @brief 指纹之外的碰撞校验信息
+     */
+    struct Check {
+        size_t distinct = 0; ///< 去重后的约束个数
+        uint64_t mixed = 0;  ///< 各约束哈希再次混合后的和
+
+        bool operator==(const Check& other) const {
+            return distinct == other.distinct && mixed == other.mixed;
+        }
+    };
+
+    struct Entry {
+        Check check;
+        bool satisfiable = true;
+    };
+
+    static Check check(const PathConstraint& constraint);
+
+    std::unordered_map<uint64_t, Entry> results_;
+
+    // 统计
+    size_t lookups_ = 0;
+    size_t hits_ = 0;
+    size_t collisions_ = 0;
+    size_t clears_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_ENGINE_POLICIES_H
@@ -0,0 +1,137 @@
+#ifndef CVERIFIER_ENGINE_STATISTICS_H
+#define CVERIFIER_ENGINE_STATISTICS_H
+
+#include <cstddef>
+#include <string>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 路径探索计数
+// ============================================================================
+
+/**
+ * @brief 路径探索的计数
+ *
+ * fork 模式下子进程把子树上的增量发回父进程累加，新增计数只需在
+ * EngineStatistics.cpp 的字段表中登记一次
+ */
+struct ExplorationCounters {
+    int paths = 0;                ///< 探索完的路径数
+    int prunedPaths = 0;          ///< 因预算丢弃的路径数
+    int infeasiblePaths = 0;      ///< 不可行的路径数
+    int acceleratedLoops = 0;     ///< 用闭式摘要执行的循环数
+    int duplicateStates = 0;      ///< 因指纹重复而丢弃的状态数
+    size_t deadBindings = 0;      ///< 在块边界删除的不活跃绑定数
+    size_t concretizedExprs = 0;  ///< 超出规模上限而具体化的表达式数
+    size_t abstractedExprs = 0;   ///< 超出规模上限而抽象为新符号的表达式数
+    size_t lazyPrunedForks = 0;   ///< 分叉前判定不可行、没有复制的后继数
+    size_t lazyDecidedForks = 0;  ///< 分叉前判定可行、不再求解的后继数
+    size_t inPlaceForks = 0;      ///< 沿用当前状态、没有复制的后继数
+
+    ExplorationCounters& operator+=(const ExplorationCounters& other);
+
+    /**
+     * @brief 逐项相减（基准之后的增量）
+     */
+    ExplorationCounters operator-(const ExplorationCounters& other) const;
+};
+
+/**
+ * @brief fork 子进程发回的子树统计
+ *
+ * 编码为一行 "名称=值" 字段，顺序无关；解码时拒绝未知字段和畸形的值
+ */
+struct ForkSubtreeStats {
+    ExplorationCounters counters;
+    size_t states = 0;            ///< 子树中到达的状态数
+    bool complete = false;        ///< 子树是否完整探索（没有因预算丢弃路径）
+
+    std::string encode() const;
+    static bool decode(const std::string& line, ForkSubtreeStats& stats);
+};
+
+// ============================================================================
+// 各探索模式的统计
+// ============================================================================
+
+/**
+ * @brief fork 模式统计
+ */
+struct ForkStats {
+    int subtrees = 0;             ///< 交给子进程的子树数
+    int failed = 0;               ///< 崩溃或内存耗尽的子树数
+    size_t states = 0;            ///< 子进程中到达的状态数
+
+    std::string getStatistics() const;
+};
+
+/**
+ * @brief 目标终止统计
+ */
+struct GoalStats {
+    size_t obligations = 0;       ///< 检查义务数
+    size_t reported = 0;          ///< 已报告的义务数
+    int terminatedFunctions = 0;  ///< 提前结束探索的函数数
+
+    std::string getStatistics() const;
+};
+
+/**
+ * @brief 有界模型检查统计
+ */
+struct BoundedStats {
+    size_t blocks = 0;            ///< 展开后的基本块实例数
+    size_t definitions = 0;       ///< SSA 定义数
+    size_t truncated = 0;         ///< 截断的回边实例数
+    int queries = 0;
+
+    std::string getStatistics(int bound) const;
+};
+
+/**
+ * @brief k 归纳统计
+ */
+struct InductionStats {
+    size_t candidates = 0;        ///< 尝试证明的检查点数
+    size_t proven = 0;            ///< 证明不可达的检查点数
+    size_t queries = 0;
+
+    std::string getStatistics(int k) const;
+};
+
+/**
+ * @brief 惰性抽象统计
+ */
+struct LazyStats {
+    size_t nodes = 0;             ///< 抽象可达树节点数
+    size_t covered = 0;           ///< 结束时被覆盖的节点数
+    size_t refinements = 0;       ///< 不可行错误路径的细化次数
+    size_t proven = 0;            ///< 证明不可达的检查点数
+    size_t queries = 0;
+
+    std::string getStatistics() const;
+};
+
+/**
+ * @brief 混合模糊测试统计
+ */
+struct FuzzStats {
+    size_t executions = 0;        ///< 具体执行次数
+    size_t corpus = 0;            ///< 进入语料库的输入数
+    size_t outcomes = 0;          ///< 覆盖的分支走向数
+    size_t handoffs = 0;          ///< 覆盖停滞后交给求解的次数
+    size_t queries = 0;
+    size_t solvedSeeds = 0;       ///< 求解得到、带来新覆盖的输入数
+
+    /**
+     * @param backend 具体执行后端（"native" 或 "interpreter"）
+     */
+    std::string getStatistics(const char* backend) const;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_ENGINE_STATISTICS_H
@@ -0,0 +1,158 @@
+#ifndef CVERIFIER_EXPR_CODEC_H
+#define CVERIFIER_EXPR_CODEC_H
+
+#include "cverifier/SymbolicState.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 表达式区域分配
+// ============================================================================
+
+/**
+ * @brief 表达式的区域分配器
+ *
+ * 按块（kBlockSize 字节）顺序切分，不单独释放；区域析构时析构其中的所有表达式
+ * 并归还全部内存。区域中的表达式只能引用同一区域或生命周期更长的表达式。
+ */
+class ExprArena {
+public:
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    ExprArena() = default;
+    ~ExprArena();
+
+    ExprArena(const ExprArena&) = delete;
+    ExprArena& operator=(const ExprArena&) = delete;
+
+    /**
+     * @brief 在区域中构造表达式
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_base_of<Expr, T>::value, "ExprArena only holds expressions");
+        T* expr = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        exprs_.push_back(expr);
+        return expr;
+    }
+
+    /**
+     * @brief 分配未初始化的内存（随区域一起释放，不调用析构函数）
+     */
+    void* allocate(size_t size, size_t align);
+
+    /**
+     * @brief 已分配的字节数（不含块末尾未用的部分）
+     */
+    size_t getBytesUsed() const { return bytesUsed_; }
+
+    size_t getNumBlocks() const { return blocks_.size(); }
+    size_t getNumExprs() const { return exprs_.size(); }
+
+private:
+    std::vector<std::unique_ptr<unsigned char[]>> blocks_;
+    std::vector<Expr*> exprs_;     ///< 析构时逐个析构
+    unsigned char* next_ = nullptr;
+    unsigned char* end_ = nullptr;
+    size_t bytesUsed_ = 0;
+};
+
+// ============================================================================
+// 表达式二进制编码
+// ============================================================================
+
+/**
+ * @brief 表达式 DAG 的紧凑二进制编码
+ *
+ * 格式（整数均为 LEB128 变长编码，有符号数先做 zigzag）：
+ * @code
+ * "CVXE" 版本
+ * 符号数  { 长度 字节... }              变量名表
+ * 节点数  { 类型 [运算符] 字段... }       按拓扑序，子节点在前
+ * 根数    { 节点序号 }
+ * @endcode
+ * 常量节点存值，变量节点存符号表序号，运算节点存子节点与自身序号之差
+ * （相邻节点差值小，多数只占一个字节）。
+ *
+ * 同一个 Expr 对象（按指针识别）只写一次，解码后的图与原图同构，
+ * 共享关系不变；多次 add() 的根共用一张节点表。
+ */
+class ExprEncoder {
+public:
+    static constexpr char kMagic[4] = {'C', 'V', 'X', 'E'};
+    static constexpr uint64_t kVersion = 1;
+
+    /**
+     * @brief 加入一个根表达式（连同尚未写入的子表达式）
+     *
+     * 根序号（解码结果中的下标）为加入前的 getNumRoots()。图中含空指针或
+     * 解码端不支持的表达式类型时失败，不加入根；已写入的子节点留在节点表中。
+     * @return 成功时返回 true
+     */
+    bool add(const Expr* root);
+
+    /**
+     * @brief 生成编码结果
+     */
+    std::string finish() const;
+
+    size_t getNumNodes() const { return numNodes_; }
+    size_t getNumRoots() const { return roots_.size(); }
+
+    const std::string& getLastError() const { return lastError_; }
+
+private:
+    bool fail(const std::string& message);
+    uint64_t symbolIndex(const std::string& name);
+    void writeNode(const Expr* expr);
+
+    std::unordered_map<const Expr*, uint64_t> nodeIndex_;
+    std::unordered_map<std::string, uint64_t> symbolIndex_;
+    std::vector<const std::string*> symbols_;  ///< 指向 symbolIndex_ 的键
+    std::string nodes_;
+    size_t numNodes_ = 0;
+    std::vector<uint64_t> roots_;
+    std::string lastError_;
+};
+
+/**
+ * @brief 解码 ExprEncoder 的结果
+ *
+ * 所有节点和节点表都分配在调用方提供的区域中；同一个变量节点的多次引用
+ * 解码为同一个 VariableExpr。输入截断、序号越界或类型未知时失败，
+ * 已分配的节点留在区域中。
+ */
+class ExprDecoder {
+public:
+    explicit ExprDecoder(ExprArena& arena) : arena_(arena) {}
+
+    /**
+     * @brief 解码
+     * @param roots 输出：按 add() 的顺序排列的根表达式
+     * @return 输入格式正确时返回 true
+     */
+    bool decode(const std::string& data, std::vector<Expr*>& roots);
+
+    const std::string& getLastError() const { return lastError_; }
+
+private:
+    bool fail(const std::string& message);
+
+    ExprArena& arena_;
+    std::string lastError_;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_EXPR_CODEC_H
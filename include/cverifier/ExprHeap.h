@@ -0,0 +1,177 @@
+#ifndef CVERIFIER_EXPR_HEAP_H
+#define CVERIFIER_EXPR_HEAP_H
+
+#include "cverifier/SymbolicState.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 表达式回收纪元
+// ============================================================================
+
+/**
+ * @brief 进程级的回收纪元
+ *
+ * 回收方把不可达的表达式登记在当前纪元下，然后推进纪元；其他线程在持有
+ * 表达式指针期间（例如求解查询从提交到完成）钉住当时的纪元。某一纪元
+ * 登记的表达式要等到所有不晚于它的钉住都释放后才真正释放，读者不会读到
+ * 已释放的节点。
+ */
+class ExprEpoch {
+public:
+    /**
+     * @brief 钉住（可移动，析构时释放）
+     */
+    class Pin {
+    public:
+        Pin() = default;
+        ~Pin() { release(); }
+
+        Pin(Pin&& other) noexcept : epoch_(other.epoch_), active_(other.active_) {
+            other.active_ = false;
+        }
+        Pin& operator=(Pin&& other) noexcept;
+
+        Pin(const Pin&) = delete;
+        Pin& operator=(const Pin&) = delete;
+
+        void release();
+
+    private:
+        friend class ExprEpoch;
+        explicit Pin(uint64_t epoch) : epoch_(epoch), active_(true) {}
+
+        uint64_t epoch_ = 0;
+        bool active_ = false;
+    };
+
+    /**
+     * @brief 钉住当前纪元
+     */
+    static Pin pin();
+
+    /**
+     * @brief 推进纪元
+     * @return 推进前的纪元
+     */
+    static uint64_t advance();
+
+    /**
+     * @brief 仍被钉住的最早纪元（没有钉住时为 UINT64_MAX）
+     */
+    static uint64_t oldestPinned();
+};
+
+// ============================================================================
+// 表达式回收
+// ============================================================================
+
+/**
+ * @brief 可回收的表达式堆
+ *
+ * 线程通过 Scope 接入后，在该线程上 new 出的表达式都登记在堆中。回收在
+ * 调用者选定的安全点进行：调用者对所有仍可能被读取的表达式（各状态的
+ * 绑定、约束等）调用 mark()，sweep() 把其余登记的表达式按当前纪元退休，
+ * reclaim() 释放读者都已离开的批次。没有接入的表达式不受影响，照旧不释放。
+ *
+ * 标记使用表达式对象内的轮次字段，不额外分配；同一个堆只能由一个线程回收。
+ */
+class ExprHeap {
+public:
+    /// 登记的表达式少于这个数时不回收
+    static constexpr size_t kMinCollectObjects = 1 << 16;
+
+    /**
+     * @brief 在当前线程上把表达式分配接入 heap（为空时暂停接入），析构时恢复
+     */
+    class Scope {
+    public:
+        explicit Scope(ExprHeap* heap);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ExprHeap* previous_;
+    };
+
+    ExprHeap() = default;
+
+    /**
+     * @brief 释放已无读者的退休批次；仍被钉住的批次和存活的表达式不释放
+     */
+    ~ExprHeap();
+
+    ExprHeap(const ExprHeap&) = delete;
+    ExprHeap& operator=(const ExprHeap&) = delete;
+
+    /**
+     * @brief Expr::operator new 的实现
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Expr::operator delete 的实现
+     *
+     * 只用于构造失败时归还刚分配的内存；接入的表达式不能直接 delete
+     */
+    static void deallocate(void* ptr) noexcept;
+
+    /**
+     * @brief 登记的表达式自上次回收后翻倍（且不少于 kMinCollectObjects）
+     */
+    bool shouldCollect() const;
+
+    /**
+     * @brief 开始一轮标记
+     */
+    void beginCollection();
+
+    /**
+     * @brief 标记从 root 可达的表达式
+     */
+    void mark(const Expr* root);
+
+    /**
+     * @brief 本轮未标记的表达式按当前纪元退休，并推进纪元
+     * @return 退休的表达式数
+     */
+    size_t sweep();
+
+    /**
+     * @brief 释放读者都已离开的退休批次
+     * @return 释放的表达式数
+     */
+    size_t reclaim();
+
+    size_t getNumTracked() const { return objects_.size(); }
+    size_t getNumRetired() const { return retiredCount_; }
+    size_t getNumFreed() const { return freed_; }
+    size_t getNumCollections() const { return collections_; }
+
+private:
+    struct RetiredBatch {
+        uint64_t epoch;
+        std::vector<Expr*> exprs;
+    };
+
+    std::vector<Expr*> objects_;           ///< 登记的表达式（上次回收后存活的在前）
+    std::deque<RetiredBatch> retired_;     ///< 按纪元递增
+    std::vector<const Expr*> markStack_;
+    uint32_t round_ = 0;
+    size_t liveAfterCollection_ = 0;
+    size_t retiredCount_ = 0;              ///< 已退休尚未释放的表达式数
+    size_t freed_ = 0;
+    size_t collections_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_EXPR_HEAP_H
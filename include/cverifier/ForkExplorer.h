@@ -0,0 +1,98 @@
+#ifndef CVERIFIER_FORK_EXPLORER_H
+#define CVERIFIER_FORK_EXPLORER_H
+
+#include "cverifier/Cancellation.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 进程级 fork 探索
+// ============================================================================
+
+/**
+ * @brief 子进程资源限制
+ */
+struct ForkLimits {
+    size_t memoryLimitMB = 0;   ///< 地址空间上限（MB，0表示不限）
+    int cpuSeconds = 0;         ///< CPU 时间上限（秒，0表示不限）
+};
+
+/**
+ * @brief 子进程结束状态
+ */
+struct ForkOutcome {
+    int pid = -1;
+    bool finished = false;      ///< 子进程正常退出且发送了结束记录
+    int exitCode = -1;          ///< 正常退出时的退出码
+    int signal = 0;             ///< 被信号终止时的信号
+    size_t records = 0;         ///< 收到的记录数
+
+    std::string describe() const;
+};
+
+/**
+ * @brief 进程级 fork 探索器
+ *
+ * 每个任务在 fork() 出的子进程中运行：子进程通过写时复制继承父进程的
+ * 全部探索状态，在自己的 rlimit 下独立运行，并通过管道按行把记录流式
+ * 发回父进程。子进程崩溃或内存耗尽只会丢失它尚未发送的结果。
+ *
+ * fork() 时父进程不能有其他线程（例如求解线程池），调用者负责先停止它们。
+ */
+class ForkExplorer {
+public:
+    /**
+     * @brief 在子进程中运行的任务
+     * @param index 任务序号
+     * @param fd 写记录的管道
+     * @return 退出码
+     */
+    using ChildTask = std::function<int(size_t index, int fd)>;
+
+    /**
+     * @brief 父进程收到一条记录（不含换行）
+     */
+    using RecordHandler = std::function<void(size_t index, const std::string& record)>;
+
+    explicit ForkExplorer(ForkLimits limits = {}, CancellationToken* token = nullptr);
+
+    /**
+     * @brief 当前平台是否支持 fork 模式
+     */
+    static bool isSupported();
+
+    /**
+     * @brief 运行任务，最多同时运行 maxConcurrent 个子进程
+     *
+     * 取消时终止所有子进程
+     */
+    std::vector<ForkOutcome> run(
+        size_t numTasks,
+        size_t maxConcurrent,
+        const ChildTask& task,
+        const RecordHandler& onRecord
+    );
+
+    /**
+     * @brief 在子进程中写一条记录（记录中不能包含换行）
+     */
+    static bool writeRecord(int fd, const std::string& record);
+
+    /**
+     * @brief 结束记录：子进程在任务完成后自动发送
+     */
+    static constexpr const char* kEndRecord = "end";
+
+private:
+    ForkLimits limits_;
+    CancellationToken* token_;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_FORK_EXPLORER_H
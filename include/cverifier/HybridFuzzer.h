@@ -0,0 +1,115 @@
+#ifndef CVERIFIER_HYBRID_FUZZER_H
+#define CVERIFIER_HYBRID_FUZZER_H
+
+#include "cverifier/ConcreteInterpreter.h"
+#include "cverifier/LLIRModule.h"
+#include "cverifier/NativeExecutor.h"
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 混合模糊测试
+// ============================================================================
+
+/**
+ * @brief 具体输入：名字与符号执行引擎中的自由符号一致
+ */
+using ConcreteInputs = std::unordered_map<std::string, int64_t>;
+
+/**
+ * @brief 语料库中的一个种子
+ */
+struct FuzzSeed {
+    ConcreteInputs inputs;
+    ConcreteResult result;
+    bool fromSolver = false;   ///< 由符号求解生成
+};
+
+/**
+ * @brief 未覆盖的分支走向：某个种子执行过这条分支，但没有任何输入走过另一侧
+ */
+struct FrontierBranch {
+    const LLIRInstruction* branch = nullptr;
+    size_t successor = 0;   ///< 未覆盖的后继
+    size_t seed = 0;        ///< 经过这条分支的种子
+    size_t event = 0;       ///< 种子的分支序列中第一次经过它的位置
+};
+
+/**
+ * @brief 灰盒模糊测试循环（覆盖引导的变异）
+ *
+ * 覆盖以条件分支的走向计：一次执行走过新的 (分支, 后继) 时输入进入语料库。
+ * 变异在各输入值上进行：位翻转、小幅增减、特殊值、函数中出现的整数常量
+ * （及其 ±1）、复制另一个输入的值。随机数来自 utils::Random。
+ *
+ * 变异难以越过的分支（等于某个算出的值、多个条件的合取）通过 takeFrontier()
+ * 交给符号求解，求出的输入用 execute() 送回语料库。
+ *
+ * JIT 后端可用时用 NativeExecutor 执行，否则用 ConcreteInterpreter。
+ */
+class HybridFuzzer {
+public:
+    /**
+     * @param maxBranches 单次执行的分支指令数上限
+     */
+    HybridFuzzer(LLIRModule* module, const std::string& functionName, size_t maxBranches);
+
+    /**
+     * @brief 执行一个输入，走过新的分支走向时加入语料库
+     * @return 是否有新覆盖
+     */
+    bool execute(const ConcreteInputs& inputs, bool fromSolver = false);
+
+    /**
+     * @brief 从语料库中选一个种子变异后执行
+     * @return 是否有新覆盖
+     */
+    bool fuzzOne();
+
+    /**
+     * @brief 尚未交给求解的未覆盖分支走向（返回后标记为已尝试）
+     */
+    std::vector<FrontierBranch> takeFrontier();
+
+    const std::vector<FuzzSeed>& getCorpus() const { return corpus_; }
+
+    /**
+     * @brief 最近一次新覆盖之后的执行次数
+     */
+    size_t getExecutionsSinceProgress() const { return sinceProgress_; }
+
+    size_t getExecutions() const { return executions_; }
+    size_t getNumCoveredOutcomes() const { return covered_.size(); }
+    bool usesNativeBackend() const { return native_ != nullptr; }
+
+private:
+    using Outcome = std::pair<const LLIRInstruction*, size_t>;
+
+    ConcreteInputs mutate(const ConcreteInputs& inputs);
+
+    std::string functionName_;
+    size_t maxBranches_;
+    std::unique_ptr<NativeExecutor> native_;
+    std::unique_ptr<ConcreteInterpreter> interpreter_;
+
+    std::vector<std::string> inputNames_;
+    std::vector<int64_t> dictionary_;       ///< 函数中的整数常量及其 ±1
+    std::vector<FuzzSeed> corpus_;
+    std::set<Outcome> covered_;
+    std::set<Outcome> attempted_;           ///< 已交给求解的走向
+    size_t executions_ = 0;
+    size_t sinceProgress_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_HYBRID_FUZZER_H
@@ -149,6 +149,17 @@ public:
         return inst;
     }
 
+    static LLIRInstruction* createICmp(
+        LLIRValue* left,
+        LLIRValue* right,
+        LLIRCmpPredicate predicate,
+        SourceLocation loc = {}
+    ) {
+        auto* inst = createICmp(left, right, loc);
+        inst->setPredicate(predicate);
+        return inst;
+    }
+
     static LLIRInstruction* createFCmp(
         LLIRValue* left,
         LLIRValue* right,
@@ -225,10 +236,11 @@ public:
         LLIRBasicBlock* elseBlock,
         SourceLocation loc = {}
     ) {
-        // 条件分支需要特殊处理，这里简化为无条件分支
-        // 实际实现中应该创建一个包含条件和两个目标的基本块
+        // 操作数：条件、then 目标、else 目标（目标与 createBr 一样用基本块名称表示）
         auto* inst = new LLIRInstruction(LLIRInstructionType::Br, loc);
         inst->addOperand(condition);
+        inst->addOperand(new LLIRVariable(thenBlock->getName(), ValueType::Void));
+        inst->addOperand(new LLIRVariable(elseBlock->getName(), ValueType::Void));
         return inst;
     }
 
@@ -56,6 +56,16 @@ enum class LLIRInstructionType {
     Assert      ///< 断言（用于漏洞检测）
 };
 
+/**
+ * @brief 比较谓词（ICmp/FCmp）
+ *
+ * Unknown 表示前端没有给出谓词，比较结果按不透明的符号值处理
+ */
+enum class LLIRCmpPredicate {
+    Unknown,
+    EQ, NE, LT, LE, GT, GE
+};
+
 /**
  * @brief LLIR值基类
  */
@@ -88,6 +98,9 @@ public:
         return operands_;
     }
 
+    LLIRCmpPredicate getPredicate() const { return predicate_; }
+    void setPredicate(LLIRCmpPredicate predicate) { predicate_ = predicate; }
+
     std::string toString() const override;
 
     ValueType getValueType() const override {
@@ -99,6 +112,7 @@ private:
     LLIRInstructionType type_;
     SourceLocation location_;
     std::vector<LLIRValue*> operands_;
+    LLIRCmpPredicate predicate_ = LLIRCmpPredicate::Unknown;
 };
 
 /**
@@ -0,0 +1,79 @@
+#ifndef CVERIFIER_LIVENESS_ANALYSIS_H
+#define CVERIFIER_LIVENESS_ANALYSIS_H
+
+#include "cverifier/CFG.h"
+#include "cverifier/LLIRModule.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 活跃变量分析
+// ============================================================================
+
+/**
+ * @brief 符号存储中绑定名的活跃性（后向数据流分析）
+ *
+ * 名字与符号执行引擎的绑定一致：指令结果 "%<基本块>.<序号>"，具名变量、参数和
+ * 全局变量用原名，存储单元为 "*" 加指针名。每条指令的读写与引擎的解释方式相同：
+ * 算术、比较和 load 定义结果，store 整体覆盖单元；load 读取单元，call 和
+ * getelementptr 保守地视为读取所有指针操作数指向的单元。
+ *
+ * 函数中从未被读取的名字（例如 freshVarName() 产生的临时符号）在任何位置都不活跃。
+ * 不活跃的绑定之后不会再被读取，从状态中删除不影响执行结果。
+ */
+class LivenessAnalysis {
+public:
+    /**
+     * @param resultNames 指令到结果名的映射（引擎的 resultNames_）
+     */
+    LivenessAnalysis(CFG* cfg, const std::unordered_map<const LLIRInstruction*, std::string>& resultNames);
+
+    /**
+     * @brief 进入基本块时 name 是否活跃
+     */
+    bool isLiveIn(const CFGNode* node, const std::string& name) const;
+
+    /**
+     * @brief 离开基本块时 name 是否活跃（各后继入口活跃集合的并）
+     */
+    bool isLiveOut(const CFGNode* node, const std::string& name) const;
+
+    /**
+     * @brief 函数中读写过的名字数
+     */
+    size_t getNumNames() const { return names_.size(); }
+
+    /**
+     * @brief 数据流迭代轮数
+     */
+    size_t getNumIterations() const { return iterations_; }
+
+private:
+    using Bits = std::vector<uint64_t>;
+
+    struct BlockSets {
+        Bits use;     ///< 块内先读后写的名字
+        Bits def;     ///< 块内写入的名字
+        Bits in;
+        Bits out;
+    };
+
+    std::string valueName(const LLIRValue* value) const;
+    size_t index(const std::string& name);
+    bool test(const Bits& bits, const std::string& name) const;
+
+    const std::unordered_map<const LLIRInstruction*, std::string>& resultNames_;
+    std::unordered_map<std::string, size_t> names_;
+    std::unordered_map<const CFGNode*, BlockSets> blocks_;
+    size_t iterations_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_LIVENESS_ANALYSIS_H
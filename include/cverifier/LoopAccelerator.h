@@ -0,0 +1,97 @@
+#ifndef CVERIFIER_LOOP_ACCELERATOR_H
+#define CVERIFIER_LOOP_ACCELERATOR_H
+
+#include "cverifier/CFG.h"
+#include "cverifier/LLIRModule.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 循环加速
+// ============================================================================
+
+/**
+ * @brief 归纳变量：每次迭代按固定步长更新的标量存储单元
+ *
+ * 形如 store (add (load p), c), p，循环中对 p 只有这一次写入
+ */
+struct InductionVariable {
+    LLIRValue* slot = nullptr;   ///< 存储单元（alloca 结果、具名变量或参数）
+    int64_t step = 0;            ///< 每次迭代的增量（非零）
+};
+
+/**
+ * @brief 可加速的循环
+ *
+ * 结构要求：单个回边；只有循环头有条件分支，条件为真（或为假）时进入循环体、
+ * 否则离开循环；循环体是从循环头出发的一条链；循环中没有函数调用；
+ * 循环条件是归纳变量与循环不变量的单调比较（<、<=、>、>=，方向与步长一致）。
+ * 满足这些条件时，N 次迭代的效果可以写成迭代次数 N 的闭式表达式。
+ */
+struct AcceleratedLoop {
+    CFGNode* header = nullptr;                  ///< 循环头
+    CFGNode* exit = nullptr;                    ///< 离开循环后的节点
+    std::vector<CFGNode*> nodes;                ///< 按执行顺序排列的循环节点（第一个是循环头）
+    LLIRInstruction* branch = nullptr;          ///< 循环头的条件分支
+    bool continueOnTrue = true;                 ///< 条件为真时继续循环
+
+    std::vector<InductionVariable> inductionVariables;
+    std::vector<LLIRValue*> clobbered;          ///< 循环中写入的其他标量单元（出口处取任意值）
+
+    bool contains(const CFGNode* node) const;
+};
+
+/**
+ * @brief 循环加速分析
+ *
+ * 基于 CFG::findLoops() 找出可以用闭式摘要代替逐次展开的循环。
+ * 分析只依赖 LLIR 结构，具体的符号效果由符号执行引擎在进入循环时生成。
+ */
+class LoopAccelerator {
+public:
+    explicit LoopAccelerator(CFG* cfg);
+
+    /**
+     * @brief 获取以 header 为循环头的可加速循环
+     * @return 不可加速或不是循环头时返回 nullptr
+     */
+    const AcceleratedLoop* getLoop(const CFGNode* header) const;
+
+    /**
+     * @brief 函数中的循环数
+     */
+    size_t getNumLoops() const { return numLoops_; }
+
+    /**
+     * @brief 可加速的循环数
+     */
+    size_t getNumAccelerable() const { return loops_.size(); }
+
+    /**
+     * @brief 两个指针操作数是否指向同一个标量存储单元
+     *
+     * 同一条指令，或同名的变量/参数/全局变量
+     */
+    static bool sameSlot(const LLIRValue* a, const LLIRValue* b);
+
+private:
+    /**
+     * @brief 分析一个自然循环
+     * @param reason 不可加速的原因（调试日志用）
+     */
+    bool analyze(const std::vector<CFGNode*>& loopNodes, AcceleratedLoop& loop,
+                 std::string& reason) const;
+
+    std::unordered_map<const CFGNode*, AcceleratedLoop> loops_;
+    size_t numLoops_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_LOOP_ACCELERATOR_H
@@ -0,0 +1,103 @@
+#ifndef CVERIFIER_NATIVE_EXECUTOR_H
+#define CVERIFIER_NATIVE_EXECUTOR_H
+
+#include "cverifier/LLIRModule.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 原生具体执行（LLVM ORC JIT）
+// ============================================================================
+
+/**
+ * @brief 一次具体执行经过的条件分支
+ */
+struct BranchEvent {
+    const LLIRInstruction* branch = nullptr;
+    size_t successor = 0;    ///< 走向的后继（0 为 then，1 为 else）
+};
+
+/**
+ * @brief 一次具体执行的结果
+ */
+struct ConcreteResult {
+    bool completed = false;              ///< 函数执行到返回指令（或块尾）
+    bool truncated = false;              ///< 分支数达到上限，提前结束
+    int64_t returnValue = 0;
+    std::vector<BranchEvent> branches;   ///< 条件分支的走向（按执行顺序）
+    std::unordered_map<std::string, int64_t> cells;   ///< 结束时各存储单元的值
+};
+
+/**
+ * @brief 把 LLIR 函数降低为 LLVM IR，用 ORC LLJIT 编译为本机代码执行
+ *
+ * 语义与符号执行引擎一致，同一组输入走过的分支序列就是引擎中的一条路径：
+ * - 值都是 64 位整数，比较结果为 0/1；
+ * - 每个指针操作数对应一个存储单元（"*" + 指针名），不考虑别名；
+ * - 参数、未写入的存储单元、引擎当作自由符号的指令结果（无谓词比较、
+ *   调用、GEP 等）按名字从输入中取值，缺省为 0；名字与引擎的符号名相同，
+ *   指令结果为 "%<基本块>.<指令序号>"；
+ * - 除数为 0 时商和余数为 0，不会触发硬件异常。
+ *
+ * 每条分支指令回调一次运行时，条件分支的走向被记录下来；分支数超过上限时
+ * 提前返回，死循环的输入也能结束。
+ *
+ * 未启用 LLVM（HAVE_LLVM）时 isSupported() 返回 false，compile() 总是失败。
+ */
+class NativeExecutor {
+public:
+    explicit NativeExecutor(LLIRModule* module);
+    ~NativeExecutor();
+
+    NativeExecutor(const NativeExecutor&) = delete;
+    NativeExecutor& operator=(const NativeExecutor&) = delete;
+
+    /**
+     * @brief 是否编译了 JIT 后端
+     */
+    static bool isSupported();
+
+    /**
+     * @brief 降低并编译函数（每个函数只编译一次）
+     * @return 失败时返回 false，原因见 getLastError()
+     */
+    bool compile(const std::string& functionName);
+
+    /**
+     * @brief 以给定输入执行函数（未编译时先编译）
+     * @param maxBranches 执行的分支指令数上限
+     * @return 编译失败时 completed 为 false
+     */
+    ConcreteResult run(
+        const std::string& functionName,
+        const std::unordered_map<std::string, int64_t>& inputs,
+        size_t maxBranches = 100000
+    );
+
+    const std::string& getLastError() const { return lastError_; }
+
+    std::string getStatistics() const;
+
+private:
+    struct Impl;   ///< JIT 和已编译的函数（启用 LLVM 时）
+
+    LLIRModule* module_;
+    std::unique_ptr<Impl> impl_;
+    std::string lastError_;
+
+    size_t compiledFunctions_ = 0;
+    size_t runs_ = 0;
+    size_t truncatedRuns_ = 0;
+    size_t recordedBranches_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_NATIVE_EXECUTOR_H
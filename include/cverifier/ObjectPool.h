@@ -0,0 +1,176 @@
+#ifndef CVERIFIER_OBJECT_POOL_H
+#define CVERIFIER_OBJECT_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 对象池
+// ============================================================================
+
+/**
+ * @brief 对象池的累计统计（所有线程）
+ */
+struct PoolStatistics {
+    size_t allocations = 0;   ///< 分配次数
+    size_t reuses = 0;        ///< 由空闲链表满足的分配次数
+    size_t slabs = 0;         ///< 向系统申请的 slab 数
+    size_t live = 0;          ///< 当前存活的对象数
+    size_t slabBytes = 0;     ///< slab 占用的总字节数
+};
+
+/**
+ * @brief 定长对象的 slab 池
+ *
+ * 每个线程有自己的空闲链表和当前 slab，分配和释放都不加锁：先复用释放过的块，
+ * 再从当前 slab 顺序切分；都用完时从全局链表取回已退出线程留下的空闲块，
+ * 没有才申请新 slab（一次 kSlabObjects 个）。
+ * slab 在进程结束前不归还系统，对象可以在任何线程上释放。
+ *
+ * 通过类的 operator new / operator delete 接入，调用处仍是 new / delete：
+ * @code
+ * static void* operator new(size_t size) { return ObjectPool<T>::allocate(size); }
+ * static void operator delete(void* ptr, size_t size) { ObjectPool<T>::deallocate(ptr, size); }
+ * @endcode
+ * 大小与 T 不同的请求（派生类）直接交给全局 operator new。
+ */
+template <typename T>
+class ObjectPool {
+public:
+    static constexpr size_t kSlabObjects = 256;
+
+    static void* allocate(size_t size) {
+        if (size != sizeof(T)) {
+            return ::operator new(size);
+        }
+
+        Shared& shared = sharedState();
+        shared.allocations.fetch_add(1, std::memory_order_relaxed);
+
+        LocalCache& cache = localCache();
+        if (!cache.head && cache.next == cache.end) {
+            cache.refill();
+        }
+        if (cache.head) {
+            shared.reuses.fetch_add(1, std::memory_order_relaxed);
+            FreeNode* node = cache.head;
+            cache.head = node->next;
+            return node;
+        }
+        return cache.next++;
+    }
+
+    static void deallocate(void* ptr, size_t size) {
+        if (!ptr) {
+            return;
+        }
+        if (size != sizeof(T)) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        sharedState().deallocations.fetch_add(1, std::memory_order_relaxed);
+        LocalCache& cache = localCache();
+        auto* node = static_cast<FreeNode*>(ptr);
+        node->next = cache.head;
+        cache.head = node;
+    }
+
+    static PoolStatistics getStatistics() {
+        Shared& shared = sharedState();
+        PoolStatistics stats;
+        stats.allocations = shared.allocations.load(std::memory_order_relaxed);
+        stats.reuses = shared.reuses.load(std::memory_order_relaxed);
+        stats.live = stats.allocations - shared.deallocations.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        stats.slabs = shared.slabs.size();
+        stats.slabBytes = stats.slabs * kSlabObjects * kSlotSize;
+        return stats;
+    }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    static constexpr size_t kSlotAlign = alignof(T) > alignof(FreeNode) ? alignof(T) : alignof(FreeNode);
+    static constexpr size_t kSlotSize =
+        (std::max(sizeof(T), sizeof(FreeNode)) + kSlotAlign - 1) / kSlotAlign * kSlotAlign;
+
+    struct alignas(kSlotAlign) Slot {
+        unsigned char bytes[kSlotSize];
+    };
+
+    struct Shared {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Slot[]>> slabs;
+        FreeNode* orphans = nullptr;   ///< 已退出线程留下的空闲块
+        std::atomic<size_t> allocations{0};
+        std::atomic<size_t> deallocations{0};
+        std::atomic<size_t> reuses{0};
+    };
+
+    struct LocalCache {
+        FreeNode* head = nullptr;   ///< 释放过的块
+        Slot* next = nullptr;       ///< 当前 slab 中未用过的块
+        Slot* end = nullptr;
+
+        void refill() {
+            Shared& shared = sharedState();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            if (shared.orphans) {
+                head = shared.orphans;
+                shared.orphans = nullptr;
+                return;
+            }
+
+            shared.slabs.push_back(std::make_unique<Slot[]>(kSlabObjects));
+            next = shared.slabs.back().get();
+            end = next + kSlabObjects;
+        }
+
+        ~LocalCache() {
+            // 当前 slab 中未用过的块也交给全局链表
+            for (; next != end; ++next) {
+                auto* node = reinterpret_cast<FreeNode*>(next);
+                node->next = head;
+                head = node;
+            }
+            if (!head) {
+                return;
+            }
+            FreeNode* tail = head;
+            while (tail->next) {
+                tail = tail->next;
+            }
+            Shared& shared = sharedState();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            tail->next = shared.orphans;
+            shared.orphans = head;
+        }
+    };
+
+    static Shared& sharedState() {
+        // 不析构：静态对象析构之后仍可能有对象被释放
+        static Shared* shared = new Shared();
+        return *shared;
+    }
+
+    static LocalCache& localCache() {
+        thread_local LocalCache cache;
+        return cache;
+    }
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_OBJECT_POOL_H
@@ -0,0 +1,93 @@
+#ifndef CVERIFIER_OBLIGATION_TRACKER_H
+#define CVERIFIER_OBLIGATION_TRACKER_H
+
+#include "cverifier/CFG.h"
+#include "cverifier/LLIRModule.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 检查义务
+// ============================================================================
+
+/**
+ * @brief 函数中检查点（义务）的解决情况
+ *
+ * 每个会触发漏洞检查的指令（load/store）是一项义务。义务在第一次被报告时
+ * 解决；如果探索前沿中没有状态还能到达它，所有可达路径都已经检查过，
+ * 义务视为已证明安全；k 归纳证明检查点不可达时也在探索前直接解决。
+ * 所有义务都解决后，继续探索只会产生重复报告，引擎可以提前结束该函数。
+ */
+class ObligationTracker {
+public:
+    explicit ObligationTracker(CFG* cfg);
+
+    /**
+     * @brief 指令是否是检查点
+     */
+    static bool isCheckSite(const LLIRInstruction* inst);
+
+    /**
+     * @brief 记录检查点被报告
+     * @return 义务是否由此新解决
+     */
+    bool resolve(const LLIRInstruction* inst);
+
+    /**
+     * @brief 记录检查点已被证明不可达（不计入报告数）
+     * @return 义务是否由此新解决
+     */
+    bool discharge(const LLIRInstruction* inst);
+
+    /**
+     * @brief 按编号记录义务被报告（fork 子进程发回的结果）
+     * @return 义务是否由此新解决
+     */
+    bool resolveIndex(size_t index);
+
+    /**
+     * @brief 已解决义务的编号（编号只在同一个跟踪器及其 fork 副本之间有意义）
+     */
+    std::vector<size_t> getReportedIndices() const;
+
+    /**
+     * @brief 前沿中的状态能否到达未解决的义务
+     * @param frontier 所有待执行状态所在的节点（可重复）
+     */
+    bool hasPending(const std::vector<const CFGNode*>& frontier) const;
+
+    /**
+     * @brief 义务总数
+     */
+    size_t size() const { return sites_.size(); }
+
+    /**
+     * @brief 已报告的义务数
+     */
+    size_t getNumReported() const { return numReported_; }
+
+    /**
+     * @brief 已证明不可达的义务数
+     */
+    size_t getNumDischarged() const { return numDischarged_; }
+
+private:
+    using Bitset = std::vector<uint64_t>;
+
+    bool markResolved(size_t index);
+
+    std::unordered_map<const LLIRInstruction*, size_t> sites_;
+    std::unordered_map<const CFGNode*, Bitset> reachable_;  ///< 从节点（含自身）可达的义务
+    Bitset reported_;               ///< 已解决（报告或证明）的义务
+    size_t numReported_ = 0;
+    size_t numDischarged_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_OBLIGATION_TRACKER_H
@@ -0,0 +1,176 @@
+#ifndef CVERIFIER_RESOURCE_GOVERNOR_H
+#define CVERIFIER_RESOURCE_GOVERNOR_H
+
+#include "cverifier/Utils.h"
+#include <cstdint>
+#include <string>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 资源预算
+// ============================================================================
+
+/**
+ * @brief 预算检查结果
+ */
+enum class BudgetVerdict {
+    Ok,                   ///< 预算内
+    WallClockExceeded,    ///< 墙钟时间耗尽
+    StatesExceeded,       ///< 状态数耗尽
+    MemoryExceeded,       ///< 内存耗尽
+    SolverTimeExceeded    ///< 求解器时间耗尽
+};
+
+/**
+ * @brief 资源预算（0 表示不限）
+ */
+struct ResourceBudget {
+    double wallClockMs = 0.0;   ///< 墙钟时间（毫秒）
+    int64_t states = 0;         ///< 状态数（函数级）或基本块步数（路径级）
+    size_t memoryBytes = 0;     ///< 内存（字节）
+    double solverMs = 0.0;      ///< 求解器时间（毫秒）
+};
+
+/**
+ * @brief 单条路径的资源消耗
+ *
+ * 挂在探索状态上，分叉时由子路径继承（路径代价包含其前缀）
+ */
+struct PathUsage {
+    double wallClockMs = 0.0;   ///< 已执行时间（毫秒）
+    int64_t steps = 0;          ///< 已执行的基本块数
+    size_t memoryBytes = 0;     ///< 状态估算大小（字节）
+    double solverMs = 0.0;      ///< 已消耗的求解器时间（毫秒）
+};
+
+/**
+ * @brief 资源调度器配置
+ */
+struct GovernorConfig {
+    double totalTimeSec = 300.0;     ///< 模块总时间（秒）
+    int64_t totalStates = 10000;     ///< 模块总状态数
+    size_t memoryLimitMB = 0;        ///< 单函数内存增量上限（MB）
+    double solverTimeSec = 0.0;      ///< 模块求解器总时间（秒）
+
+    double pathTimeSec = 10.0;       ///< 单路径时间（秒）
+    int64_t pathMaxSteps = 100;      ///< 单路径最大基本块数
+    size_t pathMemoryMB = 0;         ///< 单路径状态大小上限（MB）
+    double pathSolverSec = 0.0;      ///< 单路径求解器时间（秒）
+};
+
+// ============================================================================
+// 资源调度器
+// ============================================================================
+
+/**
+ * @brief 按函数/路径分配资源预算的调度器
+ *
+ * 模块级预算构成一个资源池。每个函数开始时从池中按
+ * 「剩余资源 / 剩余函数数」领取份额，结束时未用完的部分
+ * 自然留在池中，供后续（以及被挂起后恢复的）昂贵函数使用。
+ */
+class ResourceGovernor {
+public:
+    explicit ResourceGovernor(const GovernorConfig& config = {});
+
+    /**
+     * @brief 开始一次模块级分析（重置资源池）
+     */
+    void beginModule();
+
+    /**
+     * @brief 开始一个函数
+     * @param name 函数名
+     * @param remainingFunctions 包括当前函数在内还需分配预算的函数数
+     */
+    void beginFunction(const std::string& name, size_t remainingFunctions);
+
+    /**
+     * @brief 结束当前函数，未用完的预算回到资源池
+     */
+    void endFunction();
+
+    /**
+     * @brief 检查当前函数是否仍在预算内
+     */
+    BudgetVerdict checkFunction() const;
+
+    /**
+     * @brief 检查路径是否仍在预算内
+     */
+    BudgetVerdict checkPath(const PathUsage& usage) const;
+
+    /**
+     * @brief 记录一个新状态
+     */
+    void chargeState() {
+        ++functionStates_;
+    }
+
+    /**
+     * @brief 记录求解器耗时（毫秒）
+     */
+    void chargeSolverTime(double ms) {
+        functionSolverMs_ += ms;
+    }
+
+    /**
+     * @brief 获取当前函数的预算
+     */
+    const ResourceBudget& getFunctionBudget() const {
+        return functionBudget_;
+    }
+
+    /**
+     * @brief 获取单路径预算
+     */
+    const ResourceBudget& getPathBudget() const {
+        return pathBudget_;
+    }
+
+    /**
+     * @brief 当前进程的常驻内存（字节，不可用时返回0）
+     */
+    static size_t residentMemoryBytes();
+
+    /**
+     * @brief 预算检查结果的可读名称
+     */
+    static const char* verdictToString(BudgetVerdict verdict);
+
+    std::string getStatistics() const;
+
+private:
+    GovernorConfig config_;
+    ResourceBudget pathBudget_;
+
+    // 模块级资源池
+    utils::Timer moduleTimer_;
+    int64_t moduleStates_ = 0;
+    double moduleSolverMs_ = 0.0;
+
+    // 当前函数
+    std::string currentFunction_;
+    ResourceBudget functionBudget_;
+    utils::Timer functionTimer_;
+    int64_t functionStates_ = 0;
+    double functionSolverMs_ = 0.0;
+    size_t functionBaseMemory_ = 0;
+    bool inFunction_ = false;
+
+    // 常驻内存读取代价较高（打开并解析 /proc），按时间间隔采样
+    mutable utils::Timer memorySampleTimer_;
+    mutable size_t sampledMemory_ = 0;
+
+    // 统计
+    int functionsStarted_ = 0;
+    int functionsExhausted_ = 0;
+    mutable BudgetVerdict lastVerdict_ = BudgetVerdict::Ok;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_RESOURCE_GOVERNOR_H
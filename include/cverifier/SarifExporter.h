@@ -0,0 +1,62 @@
+#ifndef CVERIFIER_SARIF_EXPORTER_H
+#define CVERIFIER_SARIF_EXPORTER_H
+
+#include "cverifier/Core.h"
+#include <string>
+#include <vector>
+
+namespace cverifier {
+namespace report {
+
+// ============================================================================
+// SARIF 导出
+// ============================================================================
+
+/**
+ * @brief SARIF 2.1.0 报告导出器
+ *
+ * 输出只由报告内容决定：结果按规范顺序（文件、行、列、规则、严重程度、
+ * 消息）排序，相同位置的重复报告合并为一条并记录出现次数，不包含时间戳、
+ * 耗时等随运行变化的字段。配合确定性探索模式，同一输入的两次运行得到
+ * 逐字节相同的文件，可以直接在 CI 中比较。
+ */
+class SarifExporter {
+public:
+    /**
+     * @brief 导出到文件
+     * @return 文件无法写入时返回 false
+     */
+    bool exportToFile(const AnalysisResult& result, const std::string& filename) const;
+
+    /**
+     * @brief 生成 SARIF 日志（JSON 文本）
+     */
+    std::string buildSarifLog(const std::vector<VulnerabilityReport>& reports) const;
+
+    /**
+     * @brief 报告的规范顺序
+     */
+    static bool canonicalLess(const VulnerabilityReport& a, const VulnerabilityReport& b);
+
+    /**
+     * @brief 漏洞类型对应的 SARIF 规则 ID（如 "buffer-overflow"）
+     */
+    static const char* ruleId(VulnerabilityType type);
+
+private:
+    /**
+     * @brief 生成单个结果对象
+     * @param ruleIndex 规则在 tool.driver.rules 中的位置
+     * @param occurrences 合并的重复报告数
+     */
+    std::string buildResult(
+        const VulnerabilityReport& report,
+        size_t ruleIndex,
+        size_t occurrences
+    ) const;
+};
+
+} // namespace report
+} // namespace cverifier
+
+#endif // CVERIFIER_SARIF_EXPORTER_H
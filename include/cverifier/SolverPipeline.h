@@ -0,0 +1,128 @@
+#ifndef CVERIFIER_SOLVER_PIPELINE_H
+#define CVERIFIER_SOLVER_PIPELINE_H
+
+#include "cverifier/Cancellation.h"
+#include "cverifier/ExprHeap.h"
+#include "cverifier/SymbolicState.h"
+#include "cverifier/Z3Solver.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 异步求解流水线
+// ============================================================================
+
+/**
+ * @brief 求解查询句柄
+ */
+using SolverTicket = uint64_t;
+
+/**
+ * @brief 已完成的求解查询
+ */
+struct SolverCompletion {
+    SolverTicket ticket = 0;
+    SolverResult result = SolverResult::Unknown;
+    double solverMs = 0.0;      ///< 求解耗时（毫秒，不含排队时间）
+};
+
+/**
+ * @brief 异步求解流水线
+ *
+ * 查询在专用的求解线程池上运行，每个线程独占一个 Z3Solver（Z3 上下文
+ * 不能被并发使用）。探索线程提交查询后立即返回，之后通过 tryCollect()
+ * 轮询或在无事可做时用 waitCollect() 阻塞等待结果。
+ *
+ * 提交的表达式在查询完成前必须保持有效且不被修改。
+ */
+class SolverPipeline {
+public:
+    /**
+     * @param numWorkers 求解线程数（至少为1）
+     * @param token 取消令牌，取消时中断所有正在运行的查询
+     * @param timeoutMs 单次查询超时（毫秒）
+     * @param resourceLimit 单次查询的 Z3 资源上限（0表示不限）
+     */
+    SolverPipeline(
+        size_t numWorkers,
+        CancellationToken* token = nullptr,
+        unsigned int timeoutMs = 5000,
+        unsigned int resourceLimit = 0
+    );
+    ~SolverPipeline();
+
+    // 禁止拷贝
+    SolverPipeline(const SolverPipeline&) = delete;
+    SolverPipeline& operator=(const SolverPipeline&) = delete;
+
+    /**
+     * @brief 提交一个可满足性查询（约束的合取）
+     */
+    SolverTicket submit(std::vector<Expr*> constraints);
+
+    /**
+     * @brief 取一个已完成的结果（不阻塞）
+     * @return 没有已完成的结果时返回 false
+     */
+    bool tryCollect(SolverCompletion& out);
+
+    /**
+     * @brief 等待一个结果
+     * @return 没有未完成的查询时返回 false
+     */
+    bool waitCollect(SolverCompletion& out);
+
+    /**
+     * @brief 已提交但尚未被取走结果的查询数
+     */
+    size_t outstanding() const;
+
+    size_t getNumWorkers() const { return workers_.size(); }
+
+    std::string getStatistics() const;
+
+private:
+    struct Query {
+        SolverTicket ticket;
+        std::vector<Expr*> constraints;
+        ExprEpoch::Pin pin;   ///< 求解完成前约束中的表达式不被回收
+    };
+
+    void workerLoop(Z3Solver* solver);
+
+    std::vector<std::unique_ptr<Z3Solver>> solvers_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable queryReady_;
+    std::condition_variable resultReady_;
+    std::deque<Query> queries_;
+    std::deque<SolverCompletion> results_;
+    std::vector<std::thread> workers_;
+    bool shutdown_ = false;
+
+    SolverTicket nextTicket_ = 1;
+    size_t outstanding_ = 0;
+
+    // 统计
+    size_t submitted_ = 0;
+    size_t satCount_ = 0;
+    size_t unsatCount_ = 0;
+    size_t unknownCount_ = 0;
+    double totalSolverMs_ = 0.0;
+    double maxSolverMs_ = 0.0;
+    double stallMs_ = 0.0;          ///< 探索线程阻塞等待结果的时间
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_SOLVER_PIPELINE_H
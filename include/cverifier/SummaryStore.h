@@ -0,0 +1,117 @@
+#ifndef CVERIFIER_SUMMARY_STORE_H
+#define CVERIFIER_SUMMARY_STORE_H
+
+#include "cverifier/Core.h"
+#include "cverifier/LLIRModule.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 函数摘要
+// ============================================================================
+
+/**
+ * @brief 摘要键：函数内容哈希 + 分析配置哈希
+ *
+ * 内容哈希只依赖函数自身的 LLIR（名称、基本块、指令、操作数、源码位置），
+ * 因此静态链接同一份库代码的不同模块得到相同的键
+ */
+struct SummaryKey {
+    uint64_t contentHash = 0;
+    uint64_t configHash = 0;
+
+    std::string toString() const;
+};
+
+/**
+ * @brief 函数摘要
+ *
+ * 只为完整探索（未因预算或取消而提前结束）的函数生成
+ */
+struct FunctionSummary {
+    std::string function;                        ///< 函数名
+    SummaryKey key;
+
+    std::vector<std::string> preconditions;      ///< 触发漏洞报告的路径条件
+    std::vector<std::string> postconditions;     ///< 每条返回路径："条件 => ret = 值"
+    std::vector<std::string> heapEffects;        ///< 返回时仍存活的堆分配
+    std::vector<VulnerabilityReport> reports;    ///< 函数内发现的漏洞
+
+    int exploredPaths = 0;                       ///< 生成摘要时探索的路径数
+    size_t reachedStates = 0;                    ///< 生成摘要时到达的状态数
+
+    /**
+     * @brief 添加一条条件/效果（去重，超过上限时丢弃）
+     */
+    static void addUnique(std::vector<std::string>& entries, const std::string& entry);
+
+    /**
+     * @brief 转义/反转义单个字段（制表符、换行、反斜杠），编码结果不含换行
+     */
+    static std::string escapeField(const std::string& str);
+    static std::string unescapeField(const std::string& str);
+
+    /**
+     * @brief 把漏洞报告编码为一行（摘要文件和 fork 子进程管道共用）
+     */
+    static std::string encodeReport(const VulnerabilityReport& report);
+    static bool decodeReport(const std::string& line, VulnerabilityReport& report);
+};
+
+// ============================================================================
+// 摘要库
+// ============================================================================
+
+/**
+ * @brief 磁盘上的函数摘要库
+ *
+ * 每个摘要存为目录下的一个文件 <contentHash>-<configHash>.summary，
+ * 写入时先写临时文件再重命名，多个分析进程可以共享同一目录
+ */
+class SummaryStore {
+public:
+    explicit SummaryStore(const std::string& directory);
+
+    /**
+     * @brief 计算函数内容哈希
+     */
+    static uint64_t hashFunction(const LLIRFunction* func);
+
+    /**
+     * @brief 查找摘要（先查内存，再查磁盘）
+     */
+    bool lookup(const SummaryKey& key, FunctionSummary& summary);
+
+    /**
+     * @brief 保存摘要
+     */
+    bool store(const FunctionSummary& summary);
+
+    const std::string& getDirectory() const { return directory_; }
+
+    std::string getStatistics() const;
+
+private:
+    std::string pathFor(const SummaryKey& key) const;
+
+    bool readFile(const std::string& path, FunctionSummary& summary) const;
+    bool writeFile(const std::string& path, const FunctionSummary& summary) const;
+
+    std::string directory_;
+    bool usable_;
+    std::unordered_map<std::string, FunctionSummary> cache_;
+
+    int hits_ = 0;
+    int misses_ = 0;
+    int writes_ = 0;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_SUMMARY_STORE_H
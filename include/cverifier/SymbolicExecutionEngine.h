@@ -3,12 +3,31 @@
 
 #include "cverifier/LLIRModule.h"
 #include "cverifier/SymbolicState.h"
+#include "cverifier/BlockTransferCache.h"
 #include "cverifier/CFG.h"
+#include "cverifier/AbstractReachabilityTree.h"
+#include "cverifier/Cancellation.h"
 #include "cverifier/Core.h"
+#include "cverifier/EdgeCoverage.h"
+#include "cverifier/EnginePolicies.h"
+#include "cverifier/EngineStatistics.h"
+#include "cverifier/ExprHeap.h"
+#include "cverifier/ForkExplorer.h"
+#include "cverifier/HybridFuzzer.h"
+#include "cverifier/LivenessAnalysis.h"
+#include "cverifier/LoopAccelerator.h"
+#include "cverifier/ObjectPool.h"
+#include "cverifier/ObligationTracker.h"
+#include "cverifier/ResourceGovernor.h"
+#include "cverifier/SolverPipeline.h"
+#include "cverifier/SummaryStore.h"
+#include "cverifier/UnrolledCFG.h"
 #include "cverifier/Utils.h"
+#include "cverifier/VulnerabilityCheckers.h"
+#include <functional>
 #include <memory>
-#include <queue>
 #include <stack>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -25,13 +44,65 @@ namespace core {
 struct ExplorationState {
     SymbolicState* symbolicState;  ///< 符号状态
     CFGNode* currentNode;          ///< 当前CFG节点
+    CFGNode* previousNode;         ///< 转移到当前节点前所在的节点（函数入口为空）
     int instructionIndex;          ///< 当前指令索引
     std::vector<SourceLocation> trace;  ///< 执行轨迹
+    PathUsage usage;               ///< 路径资源消耗（含前缀）
+    bool needsFeasibilityCheck;    ///< 新增了分支约束，尚未确认路径可行
+    bool newCoverage;              ///< 进入当前节点的转移第一次覆盖了这条边
+
+    /// 稳定路径前缀：从函数入口起，每个多后继分支选择的后继序号。
+    /// 与调度顺序、线程数和进程数无关，用作确定性模式下的排序键
+    std::vector<uint32_t> pathId;
 
     ExplorationState(SymbolicState* state, CFGNode* node)
-        : symbolicState(state), currentNode(node), instructionIndex(0) {}
+        : symbolicState(state), currentNode(node), previousNode(nullptr), instructionIndex(0),
+          needsFeasibilityCheck(false), newCoverage(false) {}
+
+    // 每次分叉和路径结束各一次，从对象池分配
+    static void* operator new(size_t size) { return ObjectPool<ExplorationState>::allocate(size); }
+    static void operator delete(void* ptr, size_t size) { ObjectPool<ExplorationState>::deallocate(ptr, size); }
+};
+
+// ============================================================================
+// 探索进度
+// ============================================================================
+
+/**
+ * @brief 探索进度快照（通过进度回调推送）
+ */
+struct ExplorationProgress {
+    std::string function;          ///< 正在分析的函数
+    size_t functionsCompleted = 0; ///< 已完成的函数数
+    size_t totalFunctions = 0;     ///< 函数总数
+    double elapsedSec = 0.0;       ///< 已用时间（秒）
+    double statesPerSec = 0.0;     ///< 状态吞吐率
+    size_t frontierSize = 0;       ///< 工作列表（前沿）大小
+    double coverage = 0.0;         ///< 当前函数的基本块覆盖率 [0, 1]
+    int exploredPaths = 0;         ///< 已探索路径数
+    size_t reachedStates = 0;      ///< 已到达状态数
+    int reportsFound = 0;          ///< 已发现的漏洞报告数
+    bool finished = false;         ///< 是否为最后一次推送
+    bool cancelled = false;        ///< 是否因 stop() 而提前结束
+
+    /**
+     * @brief 转换为 /ws/tasks/{id}/progress 的进度消息（JSON）
+     *
+     * 格式与 web-ui/src/services/websocket.ts 中的 ProgressMessage 一致，
+     * 文件级字段由调用方（任务调度器）提供
+     */
+    std::string toJson(
+        const std::string& taskId,
+        size_t filesAnalyzed = 0,
+        size_t totalFiles = 1
+    ) const;
 };
 
+/**
+ * @brief 进度回调
+ */
+using ProgressCallback = std::function<void(const ExplorationProgress&)>;
+
 // ============================================================================
 // 符号执行引擎
 // ============================================================================
@@ -43,7 +114,17 @@ enum class ExplorationStrategy {
     DFS,       ///< 深度优先搜索
     BFS,       ///< 广度优先搜索
     Hybrid,    ///< 混合策略（DFS + BFS）
-    Random     ///< 随机搜索
+    Random,    ///< 随机搜索
+    Coverage,  ///< 覆盖引导（优先走未覆盖的边）
+    Bandit     ///< 多臂老虎机元策略（按收益率在以上策略间分配时间片）
+};
+
+/**
+ * @brief 表达式超出规模预算时的处理方式
+ */
+enum class ExprBudgetPolicy {
+    Concretize,   ///< 具体化为当前路径约束下的一个模型值，并把 expr == 值 加入路径约束
+    Abstract      ///< 抽象为新的自由符号，约束在表达式的取值区间内
 };
 
 /**
@@ -54,8 +135,36 @@ struct SymbolicExecutionConfig {
     int maxDepth = 100;                    ///< 最大探索深度
     int maxStates = 10000;                 ///< 最大状态数
     int timeout = 300;                     ///< 超时时间（秒）
+    int timeoutPerPath = 10;               ///< 单路径超时时间（秒）
+    int memoryPerPathMB = 0;               ///< 单路径状态估算大小上限（MB，0表示不限）
+    int solverTimePerPath = 0;             ///< 单路径求解器时间上限（秒，0表示不限）
+    int memoryLimitMB = 0;                 ///< 单函数内存增量上限（MB，0表示不限）
+    int solverTimeBudget = 0;              ///< 模块求解器总时间（秒，0表示不限）
+    bool enableResourceGovernor = true;    ///< 启用函数/路径级资源调度
     bool enableStateMerging = true;        ///< 启用状态合并
     bool enablePathPruning = true;         ///< 启用路径剪枝
+    int solverThreads = 2;                 ///< 异步求解线程数（0表示在探索线程上同步求解）
+    bool enableLoopAcceleration = true;    ///< 用闭式摘要代替简单计数循环的逐次展开
+    bool enableTransferCache = true;       ///< 缓存基本块的参数化转移摘要，重复访问时只做替换
+    int forkWorkers = 0;                   ///< fork 模式并发子进程数（0表示不使用）
+    int forkMemoryLimitMB = 0;             ///< fork 模式每个子进程的地址空间上限（MB，0表示不限）
+    std::string summaryDir;                ///< 函数摘要库目录（空表示不使用）
+    bool deterministic = false;            ///< 确定性模式：只用逻辑步数预算，按路径前缀顺序合并结果
+    bool enableGoalTermination = false;    ///< 函数的所有检查点都已报告或不可再达时提前结束该函数
+    bool enableFeasibilityCache = true;    ///< 相同约束集合的可行性结论直接复用
+    int bmcBound = 0;                      ///< 有界模型检查的回边展开上限（0表示使用路径探索）
+    int kInduction = 0;                    ///< 探索前用 k 归纳证明检查点不可达（0表示不证明）
+    bool enableLazyAbstraction = false;    ///< 用惰性抽象（抽象可达树 + 插值细化）代替路径探索
+    bool enableHybridFuzzing = false;      ///< 用混合模糊测试（变异 + 停滞时符号求解）代替路径探索
+    int fuzzPlateau = 256;                 ///< 连续多少次执行没有新覆盖时交给符号求解
+    bool enableStateDeduplication = true;  ///< 丢弃在同一程序点已出现过的相同状态（按状态指纹）
+    bool enableDeadBindingElimination = true;  ///< 在基本块边界删除之后不再读取的绑定（活跃变量分析）
+    int maxExprSize = 4096;                ///< 绑定的表达式节点数上限（0表示不限）
+    int maxExprDepth = 256;                ///< 绑定的表达式深度上限（0表示不限）
+    ExprBudgetPolicy exprBudgetPolicy = ExprBudgetPolicy::Concretize;  ///< 超出上限时的处理方式
+    bool enableLazyFork = true;            ///< 分叉前先判定各后继的分支约束，只为可能可行的后继复制状态
+    bool retainReachedStates = false;      ///< 保留执行过的状态供 getReachedStates() 查询（打开后分支不能沿用当前状态，每个后继都复制）
+    bool enableExprReclamation = false;    ///< 回收探索中不再被任何状态引用的表达式
     bool verbose = false;                  ///< 详细输出
 };
 
@@ -89,6 +198,8 @@ public:
 
     /**
      * @brief 获取所有可达的符号状态
+     *
+     * 只在打开 retainReachedStates 时有内容；默认执行过的状态随即释放，这里为空
      */
     const std::vector<SymbolicState*>& getReachedStates() const {
         return reachedStates_;
@@ -98,7 +209,7 @@ public:
      * @brief 获取探索的路径数
      */
     int getExploredPaths() const {
-        return exploredPaths_;
+        return counters_.paths;
     }
 
     /**
@@ -108,11 +219,69 @@ public:
         return foundVulnerabilities_;
     }
 
+    /**
+     * @brief 获取发现的漏洞报告（包括从摘要库复用的报告）
+     */
+    const std::vector<VulnerabilityReport>& getReports() const {
+        return reports_;
+    }
+
     /**
      * @brief 设置配置
      */
     void setConfig(const SymbolicExecutionConfig& config) {
         config_ = config;
+        configureGovernor();
+        configureSummaryStore();
+        solverPipeline_.reset();
+        proofPipeline_.reset();
+    }
+
+    /**
+     * @brief 获取函数摘要库（未启用时为空）
+     */
+    SummaryStore* getSummaryStore() const {
+        return summaryStore_.get();
+    }
+
+    /**
+     * @brief 获取资源调度器
+     */
+    ResourceGovernor* getGovernor() const {
+        return governor_.get();
+    }
+
+    /**
+     * @brief 请求停止分析（线程安全）
+     *
+     * 探索循环在当前基本块结束后退出，正在运行的 Z3 查询被立即中断
+     */
+    void stop() {
+        cancelToken_.cancel();
+    }
+
+    /**
+     * @brief 是否已请求停止
+     */
+    bool isStopped() const {
+        return cancelToken_.isCancelled();
+    }
+
+    /**
+     * @brief 获取取消令牌（用于注册额外的中断处理器）
+     */
+    CancellationToken& getCancellationToken() {
+        return cancelToken_;
+    }
+
+    /**
+     * @brief 设置进度回调
+     * @param callback 在探索线程上调用，应尽快返回
+     * @param intervalMs 两次推送的最小间隔（毫秒）
+     */
+    void setProgressCallback(ProgressCallback callback, unsigned int intervalMs = 250) {
+        progressCallback_ = std::move(callback);
+        progressIntervalMs_ = intervalMs;
     }
 
     /**
@@ -121,6 +290,197 @@ public:
     std::string getStatistics() const;
 
 private:
+    /**
+     * @brief 探索循环的结束原因
+     */
+    enum class ExploreOutcome {
+        Completed,        ///< 工作列表耗尽，或所有检查义务都已解决
+        BudgetExhausted,  ///< 函数预算耗尽（可挂起后恢复）
+        Aborted,          ///< 全局限制触发
+        FrontierSplit     ///< 前沿达到 fork 拆分宽度（仅 fork 模式）
+    };
+
+    /// 确定性模式下单次可行性查询的 Z3 资源上限（代替墙钟超时，普通查询远用不完）
+    static constexpr unsigned int kDeterministicSolverRlimit = 20000000;
+
+    static bool isTerminator(const LLIRInstruction* inst);
+
+    /**
+     * @brief 摘要中的前置条件：路径约束的合取
+     */
+    static std::string conjunctionString(const std::vector<Expr*>& constraints);
+
+    /**
+     * @brief 因预算耗尽而挂起的函数
+     */
+    struct SuspendedFunction {
+        std::string name;
+        CFG* cfg;
+        Worklist worklist;
+        std::unordered_set<CFGNode*> visitedNodes;
+        std::unordered_set<uint64_t> visitedStates;
+        std::unique_ptr<FunctionSummary> summary;
+        std::unique_ptr<ObligationTracker> obligations;
+        int prunedAtStart;   ///< 函数开始时的 counters_.prunedPaths
+    };
+
+    /**
+     * @brief 分析单个函数
+     * @param remainingFunctions 包括当前函数在内尚未分析的函数数
+     * @param allowSuspend 预算耗尽时是否挂起等待剩余预算
+     */
+    void exploreFunction(
+        const std::string& functionName,
+        size_t remainingFunctions,
+        bool allowSuspend
+    );
+
+    /**
+     * @brief 用剩余预算恢复被挂起的函数
+     */
+    void resumeSuspendedFunctions();
+
+    /**
+     * @brief 根据配置创建资源调度器
+     */
+    void configureGovernor();
+
+    /**
+     * @brief fork 模式探索：前沿足够宽后，每个子树交给一个子进程
+     */
+    ExploreOutcome exploreForked();
+
+    /**
+     * @brief 合并子进程发回的一条记录
+     * @param completed 收到统计记录时设置子树是否完整探索
+     */
+    void mergeForkRecord(const std::string& record, bool& completed);
+
+    /**
+     * @brief 根据配置打开函数摘要库
+     */
+    void configureSummaryStore();
+
+    /**
+     * @brief 影响分析结果的配置项的哈希
+     */
+    uint64_t configHash() const;
+
+    /**
+     * @brief 复用已有摘要代替探索
+     */
+    void applySummary(const FunctionSummary& summary);
+
+    /**
+     * @brief 把当前函数的摘要写入摘要库
+     */
+    void persistSummary();
+
+    /**
+     * @brief 记录一个漏洞报告（接管所有权）
+     */
+    void recordReport(SymbolicState* state, VulnerabilityReport* report);
+
+    /**
+     * @brief 丢弃工作列表中的所有状态
+     */
+    void discardWorklist();
+
+    /**
+     * @brief 当前路径（含正在执行的基本块）的资源消耗
+     */
+    PathUsage currentPathUsage() const;
+
+    /**
+     * @brief 推送进度（按间隔限流，force 时立即推送）
+     */
+    void reportProgress(bool force = false);
+
+    /**
+     * @brief 把状态交给求解流水线，等待可行性结果
+     */
+    void parkForFeasibility(ExplorationState* explorationState);
+
+    /**
+     * @brief 收集已完成的求解结果
+     * @param block 没有已完成的结果时是否阻塞等待
+     */
+    void collectSolverResults(bool block);
+
+    /**
+     * @brief 根据求解结果恢复或剪除被挂起的状态
+     */
+    void resumeParkedState(const SolverCompletion& completion);
+
+    /**
+     * @brief 等待所有挂起的状态得到求解结果
+     */
+    void drainParkedStates();
+
+    /**
+     * @brief 按路径前缀重排工作列表（确定性模式）
+     */
+    void sortWorklistByPath();
+
+    /**
+     * @brief 状态去重的键：程序点（基本块和块内指令序号）与状态指纹的组合
+     */
+    static uint64_t stateKey(const ExplorationState* explorationState);
+
+    /**
+     * @brief 为函数中每条指令的结果分配名称
+     */
+    void nameInstructionResults(LLIRFunction* func);
+
+    /**
+     * @brief 指令结果在符号存储中的名称
+     */
+    std::string resultName(const LLIRInstruction* inst) const;
+
+    /**
+     * @brief 将 LLIR 操作数转换为符号表达式
+     */
+    Expr* operandToExpr(SymbolicState* state, LLIRValue* value);
+
+    /**
+     * @brief 具名操作数（指令结果、变量、参数、全局变量）在符号存储中的名称
+     * @return 常量等没有名字的操作数返回空字符串
+     */
+    std::string valueName(LLIRValue* value) const;
+
+    /**
+     * @brief 指针操作数指向的标量存储单元在符号存储中的名称
+     * @return 常量等不可寻址的操作数返回空字符串
+     */
+    std::string cellName(LLIRValue* ptr) const;
+
+    /**
+     * @brief 复制状态，包括路径约束（clone() 不复制路径约束）
+     */
+    SymbolicState* forkState(SymbolicState* state) const;
+
+    /**
+     * @brief 用闭式摘要执行循环：生成覆盖任意迭代的检查状态和循环出口状态
+     * @param entryState 刚进入循环头的状态（不接管所有权）
+     * @return 循环出口的探索状态，由调用者加入工作列表
+     */
+    ExplorationState* accelerateLoop(SymbolicState* entryState, const AcceleratedLoop& loop);
+
+    /**
+     * @brief 在状态上执行循环头（不含分支），返回继续循环的条件
+     */
+    Expr* evaluateLoopCondition(SymbolicState* state, const AcceleratedLoop& loop, bool check);
+
+    /**
+     * @brief 探索前沿（工作列表和等待求解的状态）能否到达未解决的检查义务
+     */
+    bool hasPendingObligations() const;
+
+    /**
+     * @brief 累计当前函数的义务统计并释放跟踪器
+     */
+    void releaseObligations();
+
     /**
      * @brief 执行单个基本块
      */
@@ -130,6 +490,22 @@ private:
         int startInstIndex
     );
 
+    /**
+     * @brief 在空模板状态上执行块的非终结指令，生成参数化转移摘要
+     * @return 块中途分支或操作堆时返回 nullptr（不可缓存）
+     */
+    std::unique_ptr<BlockTransfer> summarizeBlock(LLIRBasicBlock* bb, CFGNode* node);
+
+    /**
+     * @brief 把转移摘要实例化到状态上，并对每条指令做漏洞检查
+     */
+    void applyBlockTransfer(SymbolicState* state, LLIRBasicBlock* bb, const BlockTransfer& transfer);
+
+    /**
+     * @brief 取值的当前绑定，未绑定时绑定为同名自由符号（生成摘要时记为活跃输入）
+     */
+    Expr* lookupOrBind(SymbolicState* state, const std::string& name);
+
     /**
      * @brief 执行单条指令
      */
@@ -166,6 +542,10 @@ private:
 
     /**
      * @brief 执行分支指令
+     *
+     * 惰性分叉时只为可能可行的后继复制状态；块末的分支在不保留执行过的
+     * 状态时，最后一个后继直接沿用当前状态（当前探索状态的 symbolicState
+     * 置空，表示所有权已转移）
      */
     void executeBranch(
         SymbolicState* state,
@@ -174,6 +554,27 @@ private:
         int instIndex
     );
 
+    /**
+     * @brief 分叉前判定后继的可行性（不调用求解器）
+     *
+     * 依次尝试：不含自由符号的比较按取值区间求值、路径上已有同一条件或
+     * 其否定、可行性缓存。当前路径已确认可行，条件恒真即后继可行。
+     *
+     * @param complement 另一个后继的分支约束（可为空）
+     * @return 能判定时返回 true，结论写入 feasible
+     */
+    bool precheckGuard(const SymbolicState* state, Expr* guard, Expr* complement, bool& feasible);
+
+    /**
+     * @brief 条件分支两个后继的分支约束（无条件分支或多路分支时为空）
+     */
+    void branchGuards(
+        SymbolicState* state,
+        LLIRInstruction* inst,
+        size_t numSuccessors,
+        Expr* guards[2]
+    );
+
     /**
      * @brief 执行函数调用
      */
@@ -191,24 +592,75 @@ private:
     );
 
     /**
-     * @brief 路径探索主循环
+     * @brief 路径探索主循环：按配置选择预先实例化的策略组合
+     */
+    ExploreOutcome explore();
+
+    /**
+     * @brief 以搜索策略和求解方式为编译期参数的探索主循环
+     * @tparam Searcher 从前沿中选择下一个状态（DfsSearcher、BfsSearcher 等）
+     * @tparam Solver 可行性检查方式（DirectSolver、CachedSolver）
      */
-    void explore();
+    template <typename Searcher, typename Solver>
+    ExploreOutcome exploreWith();
 
     /**
-     * @brief DFS探索
+     * @brief 有界模型检查：把展开后的函数编码为一个公式，求解哪些检查点可达
+     *
+     * 代替当前函数的路径探索，每个检查点最多报告一次
      */
-    void exploreDFS();
+    ExploreOutcome exploreBounded();
 
     /**
-     * @brief BFS探索
+     * @brief 在展开图的每个实例上执行非终结指令，生成 SSA 编码
+     * @return 分析被取消时返回 nullptr
      */
-    void exploreBFS();
+    std::unique_ptr<UnrolledEncoding> encodeUnrolled(const UnrolledCFG& unrolled);
 
     /**
-     * @brief 混合策略探索
+     * @brief 用 k 归纳证明当前函数中不可达的检查点，并解决对应的检查义务
+     *
+     * 基础情形：从入口出发最多经过 k 次回边时不可达。归纳步：从任意循环头的
+     * 任意状态出发，前 k 次回边之间没有到达时，恰好经过 k 次回边后也不可达。
+     * 两类查询同时提交给专用的求解流水线并行求解
      */
-    void exploreHybrid();
+    void proveSafeSites();
+
+    /**
+     * @brief 惰性抽象（IMPACT）：把函数展开为抽象可达树，用不可行错误路径的
+     * 插值加强节点标签，标签被更早的同位置节点蕴含时覆盖并停止展开
+     *
+     * 代替当前函数的路径探索；树完整时未报告的检查点被证明不可达
+     */
+    ExploreOutcome exploreLazy();
+
+    /**
+     * @brief 从全自由的状态逐块执行抽象可达树上的路径
+     * @param siteEnd 末端节点只执行到这条指令之前
+     */
+    std::vector<ArtStep> encodePathSteps(const std::vector<ArtNode*>& path, size_t siteEnd);
+
+    /**
+     * @brief 混合模糊测试：具体执行的变异循环覆盖停滞后，把未覆盖的分支走向
+     * 交给求解器，求出的输入送回语料库继续变异
+     *
+     * 代替当前函数的路径探索；进入语料库的输入沿同一路径符号重放并做漏洞检查。
+     * 具体执行总次数上限为 max-states
+     */
+    ExploreOutcome exploreHybrid();
+
+    /**
+     * @brief 沿一次具体执行的分支序列符号执行（不分叉）
+     * @param flip 在第 flip 个条件分支处改走另一侧并停止；不小于分支数时
+     *             完整重放，记录覆盖并做漏洞检查
+     * @param aliases 输出：引擎生成的新符号名 -> 对应的具体执行输入名
+     * @return 翻转时返回到达翻转点的状态，路径与记录不一致时返回空
+     */
+    std::unique_ptr<SymbolicState> replayConcrete(
+        const ConcreteResult& run,
+        size_t flip,
+        std::unordered_map<std::string, std::string>* aliases
+    );
 
     /**
      * @brief 状态合并
@@ -228,127 +680,91 @@ private:
      */
     std::string freshVarName();
 
-    LLIRModule* module_;
-    SymbolicExecutionConfig config_;
-
-    std::vector<SymbolicState*> reachedStates_;
-    std::queue<ExplorationState*> worklist_;
-    std::unordered_set<std::string> visitedStates_;
-
-    int exploredPaths_;
-    int foundVulnerabilities_;
-    int varCounter_;
-    utils::Timer startTimer_;
-};
-
-// ============================================================================
-// 漏洞检测器接口
-// ============================================================================
-
-/**
- * @brief 漏洞检测器基类
- */
-class VulnerabilityChecker {
-public:
-    virtual ~VulnerabilityChecker() = default;
-
     /**
-     * @brief 检查当前状态是否存在漏洞
-     * @return 如果发现漏洞，返回漏洞报告；否则返回nullptr
+     * @brief 表达式规模调控：超出 maxExprSize / maxExprDepth 的表达式按
+     *        exprBudgetPolicy 换成常量或新符号，其他表达式原样返回
+     *
+     * 在把计算结果绑定到名字之前调用，循环中逐次增长的表达式在达到上限后
+     * 从常量或新符号重新开始，求解器翻译单个表达式的工作量有上界
      */
-    virtual VulnerabilityReport* check(
-        SymbolicState* state,
-        LLIRInstruction* inst
-    ) = 0;
+    Expr* boundExpression(SymbolicState* state, Expr* expr);
 
     /**
-     * @brief 获取检测器名称
+     * @brief 具体化：求出 expr 在当前路径约束下的一个值（失败时返回空）
      */
-    virtual std::string getName() const = 0;
-};
-
-// ============================================================================
-// 缓冲区溢出检测器
-// ============================================================================
-
-/**
- * @brief 缓冲区溢出检测器
- */
-class BufferOverflowChecker : public VulnerabilityChecker {
-public:
-    VulnerabilityReport* check(
-        SymbolicState* state,
-        LLIRInstruction* inst
-    ) override;
-
-    std::string getName() const override {
-        return "BufferOverflow";
-    }
-
-private:
-    bool isSafeAccess(
-        Expr* ptr,
-        Expr* buffer,
-        Expr* size,
-        SymbolicState* state
-    );
-};
-
-// ============================================================================
-// 空指针解引用检测器
-// ============================================================================
+    Expr* concretizeExpression(SymbolicState* state, Expr* expr);
 
-/**
- * @brief 空指针解引用检测器
- */
-class NullPointerChecker : public VulnerabilityChecker {
-public:
-    VulnerabilityReport* check(
-        SymbolicState* state,
-        LLIRInstruction* inst
-    ) override;
-
-    std::string getName() const override {
-        return "NullPointerDereference";
-    }
-};
+    /**
+     * @brief 抽象：换成新的自由符号，并加入 expr 取值区间的上下界
+     */
+    Expr* abstractExpression(SymbolicState* state, Expr* expr);
 
-// ============================================================================
-// 内存泄漏检测器
-// ============================================================================
+    /**
+     * @brief 表达式回收：标记工作列表、挂起求解、挂起函数和保留的状态
+     *        引用的表达式，其余探索中创建的表达式退休
+     *
+     * 只在主循环取状态之前调用，此时没有正在执行的状态持有临时表达式
+     */
+    void collectExprs();
 
-/**
- * @brief 内存泄漏检测器
- */
-class MemoryLeakChecker : public VulnerabilityChecker {
-public:
-    VulnerabilityReport* check(
-        SymbolicState* state,
-        LLIRInstruction* inst
-    ) override;
+    LLIRModule* module_;
+    SymbolicExecutionConfig config_;
 
-    std::string getName() const override {
-        return "MemoryLeak";
-    }
-};
+    std::vector<SymbolicState*> reachedStates_;
+    size_t reachedCount_;        ///< 执行过的状态数（不保留状态时也计数）
+    Worklist worklist_;
+    SearchContext searchContext_;
+    std::unique_ptr<FeasibilityCache> feasibilityCache_;  ///< 路径约束可行性缓存（CachedSolver）
+    std::unordered_set<uint64_t> visitedStates_;   ///< 当前函数已执行的 (程序点, 状态指纹)
+
+    std::unique_ptr<ResourceGovernor> governor_;
+    std::unique_ptr<LoopAccelerator> loopAccelerator_;   ///< 当前函数的循环加速分析
+    std::unique_ptr<LivenessAnalysis> liveness_;         ///< 当前函数绑定名的活跃性
+    std::unique_ptr<BlockTransferCache> transferCache_;  ///< 基本块转移摘要（跨函数复用）
+    std::unique_ptr<ObligationTracker> obligations_;     ///< 当前函数的检查义务（目标终止）
+    std::unique_ptr<Z3Solver> concretizeSolver_;         ///< 具体化超限表达式的求解器（首次使用时创建）
+    std::unordered_map<std::string, std::unique_ptr<EdgeCoverage>> coverage_;  ///< 各函数的边覆盖
+    EdgeCoverage* currentCoverage_;                      ///< 当前函数的边覆盖
+    bool obligationsChanged_;                            ///< 上次检查后有义务被新解决
+    BlockTransfer* recording_;                           ///< 正在生成的转移摘要（否则为空）
+    std::unique_ptr<SummaryStore> summaryStore_;
+    std::unique_ptr<FunctionSummary> currentSummary_;   ///< 正在生成的摘要
+    std::vector<VulnerabilityReport> reports_;
+    std::vector<SuspendedFunction> suspended_;
+    ExplorationState* currentExploration_;   ///< 正在执行的探索状态
+    utils::Timer stepTimer_;                 ///< 当前基本块的计时器
+
+    ExprHeap exprHeap_;          ///< 声明在求解流水线之前，流水线中的查询先结束
+    CancellationToken cancelToken_;
+    std::unique_ptr<SolverPipeline> solverPipeline_;   ///< 声明在 cancelToken_ 之后，先于令牌析构
+    std::unique_ptr<SolverPipeline> proofPipeline_;    ///< k 归纳证明的求解流水线
+    std::unordered_map<SolverTicket, ExplorationState*> parked_;  ///< 等待求解结果的状态
+    std::unordered_map<const LLIRInstruction*, std::string> resultNames_;
+    ProgressCallback progressCallback_;
+    unsigned int progressIntervalMs_;
+    utils::Timer progressTimer_;
+    std::string currentFunction_;
+    CFG* currentCFG_;
+    std::unordered_set<CFGNode*> visitedNodes_;  ///< 当前函数已执行的基本块
+    size_t functionsCompleted_;
+    size_t totalFunctions_;
+
+    ExplorationCounters counters_;
+    int foundVulnerabilities_;
+    int varCounter_;
 
-// ============================================================================
-// 整数溢出检测器
-// ============================================================================
+    GoalStats goalStats_;             ///< 目标终止
+    BoundedStats bmcStats_;           ///< 有界模型检查（EngineBounded.cpp）
+    InductionStats inductionStats_;   ///< k 归纳（EngineBounded.cpp）
+    LazyStats lazyStats_;             ///< 惰性抽象（EngineLazy.cpp）
+    FuzzStats fuzzStats_;             ///< 混合模糊测试（EngineHybrid.cpp）
 
-/**
- * @brief 整数溢出检测器
- */
-class IntegerOverflowChecker : public VulnerabilityChecker {
-public:
-    VulnerabilityReport* check(
-        SymbolicState* state,
-        LLIRInstruction* inst
-    ) override;
+    // fork 模式（EngineFork.cpp）
+    size_t splitFrontier_;       ///< 前沿达到该宽度时停止并拆分（0表示不拆分）
+    int forkChannel_;            ///< 子进程中发回记录的管道（父进程中为 -1）
+    ForkStats forkStats_;
 
-    std::string getName() const override {
-        return "IntegerOverflow";
-    }
+    utils::Timer startTimer_;
 };
 
 } // namespace core
@@ -3,8 +3,16 @@
 
 #include "cverifier/Core.h"
 #include "cverifier/LLIRModule.h"
+#include "cverifier/ObjectPool.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace cverifier {
@@ -22,6 +30,7 @@ enum class ExprType {
     Variable,      ///< 变量
     BinaryOp,      ///< 二元操作
     UnaryOp,       ///< 一元操作
+    Ite,           ///< 条件选择（if-then-else）
     Boolean,       ///< 布尔值
     NullPtr,       ///< 空指针
     Undefined      ///< 未定义
@@ -62,13 +71,59 @@ public:
 
     ExprType getType() const { return type_; }
 
+    /**
+     * @brief 结构哈希：结构相同的表达式哈希相同
+     *
+     * 表达式不可变，哈希在构造时由子表达式的哈希算出
+     */
+    uint64_t hash() const { return hash_; }
+
+    /**
+     * @brief 节点数：共享的子表达式按引用次数重复计数（饱和到 UINT32_MAX）
+     *
+     * 与求解器逐节点翻译的工作量相同，是 DAG 节点数的上界
+     */
+    uint32_t getSize() const { return size_; }
+
+    /**
+     * @brief 深度：叶子为 1
+     */
+    uint32_t getDepth() const { return depth_; }
+
     virtual std::string toString() const = 0;
     virtual bool isConstant() const { return false; }
 
+    /**
+     * @brief 分配经过当前线程的 ExprHeap（没有时直接用全局堆）
+     *
+     * 表达式仍按惯例不手动释放；接入 ExprHeap 的表达式由它在不可达后统一回收
+     */
+    static void* operator new(size_t size);
+    static void* operator new(size_t, void* place) noexcept { return place; }
+    static void operator delete(void* ptr) noexcept;
+    static void operator delete(void*, void*) noexcept {}
+
 protected:
-    Expr(ExprType type) : type_(type) {}
+    Expr(ExprType type, uint64_t hash, std::initializer_list<const Expr*> operands = {})
+        : type_(type), mark_(0), hash_(hash), size_(1), depth_(1) {
+        uint64_t size = 1;
+        for (const Expr* operand : operands) {
+            size += operand->size_;
+            depth_ = std::max(depth_, operand->depth_ + 1);
+        }
+        size_ = static_cast<uint32_t>(std::min<uint64_t>(size, std::numeric_limits<uint32_t>::max()));
+    }
+
+    static uint64_t combine(uint64_t seed, uint64_t value);
+    static uint64_t hashName(const std::string& name);
+
+    friend class ExprHeap;
 
     ExprType type_;
+    mutable uint32_t mark_;   ///< ExprHeap 标记阶段的轮次（与 type_ 共用对齐空间）
+    uint64_t hash_;
+    uint32_t size_;
+    uint32_t depth_;
 };
 
 /**
@@ -77,7 +132,9 @@ protected:
 class ConstantExpr : public Expr {
 public:
     explicit ConstantExpr(int64_t value)
-        : Expr(ExprType::Constant), value_(value) {}
+        : Expr(ExprType::Constant, combine(static_cast<uint64_t>(ExprType::Constant),
+                                           static_cast<uint64_t>(value))),
+          value_(value) {}
 
     int64_t getValue() const { return value_; }
     bool isConstant() const override { return true; }
@@ -94,7 +151,8 @@ private:
 class VariableExpr : public Expr {
 public:
     explicit VariableExpr(const std::string& name)
-        : Expr(ExprType::Variable), name_(name) {}
+        : Expr(ExprType::Variable, combine(static_cast<uint64_t>(ExprType::Variable), hashName(name))),
+          name_(name) {}
 
     const std::string& getName() const { return name_; }
     std::string toString() const override { return name_; }
@@ -109,7 +167,11 @@ private:
 class BinaryOpExpr : public Expr {
 public:
     BinaryOpExpr(BinaryOpType op, Expr* left, Expr* right)
-        : Expr(ExprType::BinaryOp), op_(op), left_(left), right_(right) {}
+        : Expr(ExprType::BinaryOp,
+               combine(combine(combine(static_cast<uint64_t>(ExprType::BinaryOp), static_cast<uint64_t>(op)),
+                               left->hash()), right->hash()),
+               {left, right}),
+          op_(op), left_(left), right_(right) {}
 
     BinaryOpType getOp() const { return op_; }
     Expr* getLeft() const { return left_; }
@@ -129,7 +191,11 @@ private:
 class UnaryOpExpr : public Expr {
 public:
     UnaryOpExpr(UnaryOpType op, Expr* operand)
-        : Expr(ExprType::UnaryOp), op_(op), operand_(operand) {}
+        : Expr(ExprType::UnaryOp,
+               combine(combine(static_cast<uint64_t>(ExprType::UnaryOp), static_cast<uint64_t>(op)),
+                       operand->hash()),
+               {operand}),
+          op_(op), operand_(operand) {}
 
     UnaryOpType getOp() const { return op_; }
     Expr* getOperand() const { return operand_; }
@@ -141,6 +207,45 @@ private:
     Expr* operand_;
 };
 
+/**
+ * @brief 条件选择表达式：cond 成立时取 thenExpr，否则取 elseExpr
+ *
+ * cond 必须是布尔表达式，两个分支的类型相同
+ */
+class IteExpr : public Expr {
+public:
+    IteExpr(Expr* cond, Expr* thenExpr, Expr* elseExpr)
+        : Expr(ExprType::Ite,
+               combine(combine(combine(static_cast<uint64_t>(ExprType::Ite), cond->hash()),
+                               thenExpr->hash()), elseExpr->hash()),
+               {cond, thenExpr, elseExpr}),
+          cond_(cond), then_(thenExpr), else_(elseExpr) {}
+
+    Expr* getCondition() const { return cond_; }
+    Expr* getThen() const { return then_; }
+    Expr* getElse() const { return else_; }
+
+    std::string toString() const override;
+
+private:
+    Expr* cond_;
+    Expr* then_;
+    Expr* else_;
+};
+
+/**
+ * @brief 表达式的值是否是布尔值（比较和逻辑运算），其他表达式（包括符号变量）是整数
+ */
+bool isBooleanExpr(const Expr* expr);
+
+/**
+ * @brief 把表达式中的变量按名字替换为绑定的值，未绑定的变量保持不变
+ *
+ * 变量是整数，布尔值按 0/1 代入。共享的子表达式只替换一次，结果与原表达式
+ * 共享没有变化的部分
+ */
+Expr* substituteVariables(Expr* expr, const std::unordered_map<std::string, Expr*>& bindings);
+
 // ============================================================================
 // 符号存储
 // ============================================================================
@@ -156,9 +261,17 @@ public:
      * @brief 绑定变量到表达式
      */
     void bind(const std::string& var, Expr* expr) {
-        store_[var] = expr;
+        Expr*& slot = store_[var];
+        fingerprint_ ^= bindingHash(var, slot) ^ bindingHash(var, expr);
+        slot = expr;
     }
 
+    /**
+     * @brief 删除满足条件的绑定
+     * @return 删除的绑定数
+     */
+    size_t removeIf(const std::function<bool(const std::string&)>& predicate);
+
     /**
      * @brief 查找变量的值
      */
@@ -167,6 +280,21 @@ public:
         return it != store_.end() ? it->second : nullptr;
     }
 
+    /**
+     * @brief 绑定数量
+     */
+    size_t size() const { return store_.size(); }
+
+    /**
+     * @brief 所有绑定
+     */
+    const std::unordered_map<std::string, Expr*>& getBindings() const { return store_; }
+
+    /**
+     * @brief 所有绑定的指纹（各绑定哈希的异或，与插入顺序无关，随 bind 增量维护）
+     */
+    uint64_t getFingerprint() const { return fingerprint_; }
+
     /**
      * @brief 克隆当前存储
      */
@@ -180,7 +308,11 @@ public:
     std::string toString() const;
 
 private:
+    /// 未绑定（空表达式）的哈希为 0，bind 时异或掉旧绑定无需区分
+    static uint64_t bindingHash(const std::string& var, const Expr* expr);
+
     std::unordered_map<std::string, Expr*> store_;
+    uint64_t fingerprint_ = 0;
 };
 
 // ============================================================================
@@ -189,14 +321,21 @@ private:
 
 /**
  * @brief 堆对象
+ *
+ * 除符号地址外，每个对象在堆的虚拟地址空间中占据一段区域 [base, base + extent)，
+ * 用于按地址把指针解析到对象。区域按分配顺序递增，对象之间留有间隔
  */
 struct HeapObject {
     Expr* address;           ///< 符号地址
     Expr* size;              ///< 对象大小
     SourceLocation allocSite; ///< 分配位置
     bool isFreed;            ///< 是否已释放
+    uint64_t base;           ///< 区域起始地址
+    uint64_t extent;         ///< 区域长度（大小不是常量时为预留长度）
 
-    HeapObject() : isFreed(false) {}
+    HeapObject() : isFreed(false), base(0), extent(0) {}
+
+    bool contains(uint64_t addr) const { return addr >= base && addr - base < extent; }
 };
 
 /**
@@ -204,15 +343,28 @@ struct HeapObject {
  */
 class SymbolicHeap {
 public:
+    /// 第一个对象的起始地址（空指针附近不分配）
+    static constexpr uint64_t kHeapBase = 0x10000;
+    /// 对象之间的间隔，越过末尾一点的指针不会落入下一个对象
+    static constexpr uint64_t kRedZone = 16;
+    /// 大小不是常量的对象预留的区域长度
+    static constexpr uint64_t kSymbolicExtent = 0x10000;
+
     SymbolicHeap() = default;
 
+    // 分叉的状态各自修改释放标记，复制时对象逐个复制（表达式不可变，直接共享）
+    SymbolicHeap(const SymbolicHeap& other);
+    SymbolicHeap& operator=(const SymbolicHeap& other);
+    SymbolicHeap(SymbolicHeap&&) = default;
+    SymbolicHeap& operator=(SymbolicHeap&&) = default;
+
     /**
      * @brief 分配内存
      */
     Expr* allocate(Expr* size, const SourceLocation& loc);
 
     /**
-     * @brief 释放内存
+     * @brief 释放内存（指针解析到某个对象的起始地址时才释放）
      */
     void free(Expr* address);
 
@@ -231,16 +383,65 @@ public:
      */
     bool mayBeNull(Expr* address) const;
 
+    /**
+     * @brief 指针可能指向的对象（按地址顺序，含已释放的对象）
+     *
+     * 指针按加减法展开为 对象地址 + 常量 + 其余部分。其余部分为空时是一次
+     * 点查询；否则 [minOffset, maxOffset] 为其余部分的取值范围（调用者从
+     * 路径约束或抽象解释得到），结果是与该范围相交的对象。
+     * 都是对有序区域的二分查找，O(log n + 结果数)。
+     * 不能展开为对象地址或常量地址的指针可能指向任何对象
+     */
+    std::vector<const HeapObject*> resolve(
+        Expr* pointer,
+        int64_t minOffset = std::numeric_limits<int64_t>::min(),
+        int64_t maxOffset = std::numeric_limits<int64_t>::max()
+    ) const;
+
+    /**
+     * @brief 把指针展开为 对象（可为空）+ 常量偏移 + 是否有其余部分
+     */
+    const HeapObject* decompose(Expr* pointer, int64_t& constant, bool& symbolic) const;
+
+    /**
+     * @brief 包含 addr 的对象（没有时返回空）
+     */
+    const HeapObject* findObject(uint64_t addr) const;
+
+    /**
+     * @brief 与地址范围 [lo, hi] 相交的对象
+     */
+    std::vector<const HeapObject*> findObjects(uint64_t lo, uint64_t hi) const;
+
     /**
      * @brief 获取所有未释放的对象
      */
     std::vector<const HeapObject*> getUnfreedObjects() const;
 
+    /**
+     * @brief 堆对象数量（含已释放）
+     */
+    size_t size() const { return objects_.size(); }
+
+    /**
+     * @brief 堆对象的指纹（与分配顺序无关，随分配和释放增量维护）
+     */
+    uint64_t getFingerprint() const { return fingerprint_; }
+
+    /**
+     * @brief 遍历对象引用的表达式（地址和大小）
+     */
+    void forEachExpr(const std::function<void(const Expr*)>& visit) const;
+
     std::string toString() const;
 
 private:
-    std::vector<std::unique_ptr<HeapObject>> objects_;
-    std::unordered_map<Expr*, HeapObject*> addressMap_;
+    static uint64_t objectHash(const HeapObject& obj);
+
+    std::vector<std::unique_ptr<HeapObject>> objects_;   ///< 按分配顺序，即按区域地址有序
+    std::unordered_map<std::string, HeapObject*> bases_; ///< 符号地址名到对象
+    uint64_t nextBase_ = kHeapBase;
+    uint64_t fingerprint_ = 0;
 };
 
 // ============================================================================
@@ -252,20 +453,22 @@ private:
  */
 class PathConstraint {
 public:
-    PathConstraint() = default;
+    PathConstraint() : body_(std::make_shared<Body>()) {}
+
+    // 复制只共享约束列表；不声明移动，移动退化为复制，源对象仍然可用
+    PathConstraint(const PathConstraint&) = default;
+    PathConstraint& operator=(const PathConstraint&) = default;
 
     /**
      * @brief 添加约束
      */
-    void add(Expr* constraint) {
-        constraints_.push_back(constraint);
-    }
+    void add(Expr* constraint);
 
     /**
      * @brief 获取所有约束
      */
     const std::vector<Expr*>& getConstraints() const {
-        return constraints_;
+        return body_->constraints;
     }
 
     /**
@@ -273,6 +476,13 @@ public:
      */
     bool isSatisfiable() const;
 
+    /**
+     * @brief 约束集合的指纹（不同约束的哈希之和，与添加顺序和重复次数无关）
+     *
+     * 循环每次迭代重新加入的相同分支约束不改变指纹
+     */
+    uint64_t getFingerprint() const { return fingerprint_; }
+
     /**
      * @brief 简化约束
      */
@@ -281,7 +491,20 @@ public:
     std::string toString() const;
 
 private:
-    std::vector<Expr*> constraints_;
+    static uint64_t constraintHash(const Expr* constraint);
+
+    /**
+     * @brief 约束列表和已出现的约束哈希
+     *
+     * 复制 PathConstraint（状态克隆、分叉）时共享，第一次 add() 时才复制（写时复制）
+     */
+    struct Body {
+        std::vector<Expr*> constraints;
+        std::unordered_set<uint64_t> seen;   ///< 约束的结构哈希，add() 中 O(1) 去重
+    };
+
+    std::shared_ptr<Body> body_;
+    uint64_t fingerprint_ = 0;
 };
 
 // ============================================================================
@@ -301,6 +524,10 @@ public:
 
     ~SymbolicState() = default;
 
+    // 分叉时频繁创建和释放，从对象池分配
+    static void* operator new(size_t size) { return ObjectPool<SymbolicState>::allocate(size); }
+    static void operator delete(void* ptr, size_t size) { ObjectPool<SymbolicState>::deallocate(ptr, size); }
+
     /**
      * @brief 获取符号存储
      */
@@ -349,6 +576,26 @@ public:
      */
     void setParent(SymbolicState* parent) { parent_ = parent; }
 
+    /**
+     * @brief 估算状态占用的内存（字节，用于路径级内存预算）
+     */
+    size_t estimateMemoryUsage() const;
+
+    /**
+     * @brief 状态指纹：存储、堆和路径约束的组合哈希
+     *
+     * 三部分各自增量维护，这里只做常数次组合。指纹相同的状态（忽略哈希冲突）
+     * 在同一程序点的后续执行完全相同；不包括父状态中的绑定
+     */
+    uint64_t getFingerprint() const;
+
+    /**
+     * @brief 遍历状态直接引用的表达式：绑定的值、堆对象和路径约束（包括父状态的）
+     *
+     * 子表达式不展开，同一表达式可能被访问多次
+     */
+    void forEachExpr(const std::function<void(const Expr*)>& visit) const;
+
     std::string toString() const;
 
 private:
@@ -0,0 +1,98 @@
+#ifndef CVERIFIER_UNROLLED_CFG_H
+#define CVERIFIER_UNROLLED_CFG_H
+
+#include "cverifier/CFG.h"
+#include "cverifier/SymbolicState.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 展开的控制流图（有界模型检查）
+// ============================================================================
+
+/**
+ * @brief 展开图中的基本块实例
+ */
+struct UnrolledBlock {
+    CFGNode* node = nullptr;
+    int layer = 0;   ///< 到达该实例前走过的回边数
+
+    /// 前驱：(前驱实例序号, 前驱节点中的后继序号)
+    std::vector<std::pair<size_t, size_t>> predecessors;
+};
+
+/**
+ * @brief 把函数的 CFG 展开为无环图
+ *
+ * 回边按入口处的 DFS 确定（与 CFG::findBackEdges() 一致），去掉回边后是
+ * 有向无环图。实例 (节点, 层) 中，前向边留在同一层，回边进入下一层；
+ * 第 bound 层的回边被截断。因此 bound 限制的是一条路径上回边的总数，
+ * 单个循环最多展开 bound 次，嵌套循环共享这个上限。
+ *
+ * 实例按层、层内按逆后序排列，前驱总是排在后继之前，只包含从起点可达的实例。
+ */
+class UnrolledCFG {
+public:
+    /**
+     * @param start 展开的起点（默认为函数入口），从循环头开始时用于归纳步
+     */
+    UnrolledCFG(CFG* cfg, int bound, CFGNode* start = nullptr);
+
+    /**
+     * @brief 拓扑序的实例（第一个是起点）
+     */
+    const std::vector<UnrolledBlock>& getBlocks() const { return blocks_; }
+
+    /**
+     * @brief 因达到展开上限而截断的回边实例数
+     */
+    size_t getNumTruncated() const { return numTruncated_; }
+
+private:
+    std::vector<UnrolledBlock> blocks_;
+    size_t numTruncated_ = 0;
+};
+
+/**
+ * @brief 实例的符号执行结果
+ */
+struct EncodedBlock {
+    std::unique_ptr<SymbolicState> state;   ///< 执行完非终结指令后的状态
+    VariableExpr* guardVar = nullptr;       ///< 到达变量（取值 0/1）
+    Expr* guard = nullptr;                  ///< 到达条件（空表示必然到达）
+    std::vector<Expr*> edgeGuards;          ///< 各出边的分支约束（空表示无条件）
+};
+
+/**
+ * @brief 展开图的 SSA 编码
+ *
+ * 公式是 definitions 的合取，每个定义形如 name@n == 值，布尔值编码为 0/1。
+ * 执行确定时恰好一条路径被走过，实例的到达变量为 1 当且仅当它在这条路径上。
+ */
+struct UnrolledEncoding {
+    std::vector<Expr*> definitions;
+    std::vector<EncodedBlock> blocks;      ///< 与 UnrolledCFG::getBlocks() 一一对应
+    std::vector<LLIRInstruction*> sites;   ///< 检查点（按首次出现的顺序）
+    std::unordered_map<const LLIRInstruction*, std::vector<size_t>> siteBlocks;  ///< 检查点所在的实例
+
+    /**
+     * @brief 引入新的 SSA 变量 name@n 并定义为 value
+     */
+    VariableExpr* define(const std::string& name, Expr* value);
+
+    /**
+     * @brief 实例集合中至少一个被走过的条件
+     * @return 某个实例必然到达时返回空；集合为空时返回恒假
+     */
+    Expr* anyReached(const std::vector<size_t>& instances) const;
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_UNROLLED_CFG_H
@@ -1,6 +1,8 @@
 #ifndef CVERIFIER_UTILS_H
 #define CVERIFIER_UTILS_H
 
+#include <cstdint>
+#include <cstdio>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -114,6 +116,31 @@ public:
         }
         return str.substr(str.size() - suffix.size()) == suffix;
     }
+
+    /**
+     * @brief JSON 字符串字面量（含引号）
+     */
+    static std::string jsonString(const std::string& str) {
+        std::string out = "\"";
+        for (char c : str) {
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char buf[8];
+                        std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+                        out += buf;
+                    } else {
+                        out += c;
+                    }
+            }
+        }
+        return out + "\"";
+    }
 };
 
 /**
@@ -226,6 +253,53 @@ public:
     }
 };
 
+/**
+ * @brief 哈希工具类（FNV-1a，64位）
+ *
+ * 结果与平台和运行无关，可用于持久化的键
+ */
+class HashUtils {
+public:
+    static constexpr uint64_t kOffsetBasis = 14695981039346656037ULL;
+    static constexpr uint64_t kPrime = 1099511628211ULL;
+
+    /**
+     * @brief 把字节序列混入哈希值
+     */
+    static uint64_t fnv1a(const void* data, size_t length, uint64_t hash = kOffsetBasis) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < length; ++i) {
+            hash ^= bytes[i];
+            hash *= kPrime;
+        }
+        return hash;
+    }
+
+    static uint64_t fnv1a(const std::string& str, uint64_t hash = kOffsetBasis) {
+        // 混入长度，避免 "ab"+"c" 与 "a"+"bc" 冲突
+        hash = fnv1a(static_cast<uint64_t>(str.size()), hash);
+        return fnv1a(str.data(), str.size(), hash);
+    }
+
+    static uint64_t fnv1a(uint64_t value, uint64_t hash = kOffsetBasis) {
+        // 按小端字节序混入，保证跨平台一致
+        for (int i = 0; i < 8; ++i) {
+            hash ^= static_cast<unsigned char>(value >> (i * 8));
+            hash *= kPrime;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief 格式化为16位十六进制字符串
+     */
+    static std::string toHex(uint64_t hash) {
+        std::ostringstream oss;
+        oss << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return oss.str();
+    }
+};
+
 /**
  * @brief 日志工具类
  */
@@ -242,6 +316,10 @@ public:
         instance().minLevel_ = level;
     }
 
+    static Level getLevel() {
+        return instance().minLevel_;
+    }
+
     static void debug(const std::string& message) {
         instance().log(Level::Debug, message);
     }
@@ -345,6 +423,13 @@ public:
         return result;
     }
 
+    /**
+     * @brief 重新设置种子（确定性模式下使随机序列可复现）
+     */
+    static void seed(uint32_t value) {
+        instance().rng_.seed(value);
+    }
+
 private:
     static Random& instance() {
         static Random random;
@@ -352,9 +437,8 @@ private:
     }
 
     std::mt19937 rng_;
-    std::random_device rd_;
 
-    Random() : rng_(rd_()) {}
+    Random() : rng_(std::random_device{}()) {}
 };
 
 } // namespace utils
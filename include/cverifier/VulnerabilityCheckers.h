@@ -0,0 +1,138 @@
+#ifndef CVERIFIER_VULNERABILITY_CHECKERS_H
+#define CVERIFIER_VULNERABILITY_CHECKERS_H
+
+#include "cverifier/Core.h"
+#include "cverifier/LLIRModule.h"
+#include "cverifier/SymbolicState.h"
+#include <string>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 漏洞检测器接口
+// ============================================================================
+
+/**
+ * @brief 漏洞检测器基类
+ */
+class VulnerabilityChecker {
+public:
+    virtual ~VulnerabilityChecker() = default;
+
+    /**
+     * @brief 检查当前状态是否存在漏洞
+     * @return 如果发现漏洞，返回漏洞报告；否则返回nullptr
+     */
+    virtual VulnerabilityReport* check(
+        SymbolicState* state,
+        LLIRInstruction* inst
+    ) = 0;
+
+    /**
+     * @brief 获取检测器名称
+     */
+    virtual std::string getName() const = 0;
+};
+
+// ============================================================================
+// 缓冲区溢出检测器
+// ============================================================================
+
+/**
+ * @brief 缓冲区溢出检测器
+ */
+class BufferOverflowChecker : public VulnerabilityChecker {
+public:
+    VulnerabilityReport* check(
+        SymbolicState* state,
+        LLIRInstruction* inst
+    ) override;
+
+    /**
+     * @brief 已知目标指针的检查
+     *
+     * 指针从堆对象导出时按对象边界判断：常量地址在堆的区域索引中查找，
+     * 含符号偏移时用求解器判断偏移能否落在 [0, size) 之外。
+     * 其他指针（或 pointer 为空）与 check(state, inst) 相同，保守地报告
+     */
+    VulnerabilityReport* check(
+        SymbolicState* state,
+        LLIRInstruction* inst,
+        Expr* pointer
+    );
+
+    std::string getName() const override {
+        return "BufferOverflow";
+    }
+
+private:
+    bool isSafeAccess(
+        Expr* ptr,
+        Expr* buffer,
+        Expr* size,
+        SymbolicState* state
+    );
+};
+
+// ============================================================================
+// 空指针解引用检测器
+// ============================================================================
+
+/**
+ * @brief 空指针解引用检测器
+ */
+class NullPointerChecker : public VulnerabilityChecker {
+public:
+    VulnerabilityReport* check(
+        SymbolicState* state,
+        LLIRInstruction* inst
+    ) override;
+
+    std::string getName() const override {
+        return "NullPointerDereference";
+    }
+};
+
+// ============================================================================
+// 内存泄漏检测器
+// ============================================================================
+
+/**
+ * @brief 内存泄漏检测器
+ */
+class MemoryLeakChecker : public VulnerabilityChecker {
+public:
+    VulnerabilityReport* check(
+        SymbolicState* state,
+        LLIRInstruction* inst
+    ) override;
+
+    std::string getName() const override {
+        return "MemoryLeak";
+    }
+};
+
+// ============================================================================
+// 整数溢出检测器
+// ============================================================================
+
+/**
+ * @brief 整数溢出检测器
+ */
+class IntegerOverflowChecker : public VulnerabilityChecker {
+public:
+    VulnerabilityReport* check(
+        SymbolicState* state,
+        LLIRInstruction* inst
+    ) override;
+
+    std::string getName() const override {
+        return "IntegerOverflow";
+    }
+};
+
+} // namespace core
+} // namespace cverifier
+
+#endif // CVERIFIER_VULNERABILITY_CHECKERS_H
@@ -1,11 +1,13 @@
 #ifndef CVERIFIER_Z3_SOLVER_H
 #define CVERIFIER_Z3_SOLVER_H
 
+#include "cverifier/Cancellation.h"
 #include "cverifier/Core.h"
 #include "cverifier/SymbolicState.h"
+#include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
-#include <memory>
 
 #ifdef HAVE_Z3
 #include <z3++.h>
@@ -99,6 +101,28 @@ public:
      */
     void setTimeout(unsigned int milliseconds);
 
+    /**
+     * @brief 设置单次查询的资源上限（Z3 rlimit，0表示不限）
+     *
+     * 与墙钟超时不同，资源上限按 Z3 内部的确定性步数计量，
+     * 同一查询在任何负载下得到相同的结果
+     */
+    void setResourceLimit(unsigned int limit);
+
+    /**
+     * @brief 中断正在进行的求解（可从其他线程调用）
+     *
+     * 被中断的查询返回 Unknown
+     */
+    void interrupt();
+
+    /**
+     * @brief 绑定取消令牌，令牌取消时自动中断求解
+     *
+     * 构造时默认绑定 CancellationToken::current()，传入 nullptr 解除绑定
+     */
+    void setCancellationToken(CancellationToken* token);
+
     /**
      * @brief 推送约束上下文（用于增量求解）
      */
@@ -161,7 +185,15 @@ private:
     CounterExample lastModel_;
 #endif
 
+    /**
+     * @brief 把超时和资源上限写入求解器参数
+     */
+    void applyParams();
+
     unsigned int timeout_;
+    unsigned int resourceLimit_;
+    CancellationToken* cancelToken_;
+    size_t interruptHandle_;
 };
 
 // ============================================================================
@@ -0,0 +1,358 @@
+/**
+ * @file ConcreteInterpreter.cpp
+ * @brief LLIR 具体解释器实现
+ */
+
+#include "cverifier/ConcreteInterpreter.h"
+#include "cverifier/LLIRValue.h"
+#include <algorithm>
+#include <limits>
+#include <set>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+/// 操作数：槽位或常量
+struct Operand {
+    size_t slot = kNone;
+    int64_t value = 0;
+};
+
+/// 一条计算指令（算术、位运算、移位、比较、load、store）
+struct Op {
+    LLIRInstructionType type = LLIRInstructionType::Add;
+    LLIRCmpPredicate predicate = LLIRCmpPredicate::Unknown;
+    size_t dst = kNone;
+    Operand lhs;
+    Operand rhs;
+};
+
+enum class Terminator {
+    Jump,       ///< 无条件分支或顺序执行到后继
+    CondBr,     ///< 条件分支
+    Ret,
+    Exit        ///< 没有后继，返回 0
+};
+
+struct Block {
+    std::vector<Op> ops;
+    Terminator terminator = Terminator::Exit;
+    const LLIRInstruction* branch = nullptr;   ///< 分支指令（顺序执行时为空）
+    Operand operand;                           ///< 分支条件或返回值
+    size_t targets[2] = {kNone, kNone};        ///< 后继块序号（kNone 表示返回 0）
+};
+
+bool computesResult(const LLIRInstruction* inst) {
+    switch (inst->getType()) {
+        case LLIRInstructionType::Add:
+        case LLIRInstructionType::Sub:
+        case LLIRInstructionType::Mul:
+        case LLIRInstructionType::Div:
+        case LLIRInstructionType::Rem:
+        case LLIRInstructionType::And:
+        case LLIRInstructionType::Or:
+        case LLIRInstructionType::Xor:
+        case LLIRInstructionType::Shl:
+        case LLIRInstructionType::Shr:
+            return inst->getOperands().size() == 2;
+        case LLIRInstructionType::ICmp:
+            return inst->getOperands().size() == 2 && inst->getPredicate() != LLIRCmpPredicate::Unknown;
+        default:
+            return false;
+    }
+}
+
+int64_t evaluate(const Op& op, int64_t lhs, int64_t rhs) {
+    // 有符号溢出按补码回绕（与 LLVM 的 add/sub/mul 一致）
+    auto ul = static_cast<uint64_t>(lhs);
+    auto ur = static_cast<uint64_t>(rhs);
+    switch (op.type) {
+        case LLIRInstructionType::Add: return static_cast<int64_t>(ul + ur);
+        case LLIRInstructionType::Sub: return static_cast<int64_t>(ul - ur);
+        case LLIRInstructionType::Mul: return static_cast<int64_t>(ul * ur);
+        case LLIRInstructionType::And: return lhs & rhs;
+        case LLIRInstructionType::Or:  return lhs | rhs;
+        case LLIRInstructionType::Xor: return lhs ^ rhs;
+        case LLIRInstructionType::Shl: return static_cast<int64_t>(ul << (rhs & 63));
+        case LLIRInstructionType::Shr: return lhs >> (rhs & 63);
+        case LLIRInstructionType::Div:
+            return rhs == 0 ? 0 : rhs == -1 ? static_cast<int64_t>(0 - ul) : lhs / rhs;
+        case LLIRInstructionType::Rem:
+            return rhs == 0 || rhs == -1 ? 0 : lhs % rhs;
+        case LLIRInstructionType::ICmp:
+            switch (op.predicate) {
+                case LLIRCmpPredicate::EQ: return lhs == rhs;
+                case LLIRCmpPredicate::NE: return lhs != rhs;
+                case LLIRCmpPredicate::LT: return lhs < rhs;
+                case LLIRCmpPredicate::LE: return lhs <= rhs;
+                case LLIRCmpPredicate::GT: return lhs > rhs;
+                case LLIRCmpPredicate::GE: return lhs >= rhs;
+                default: return 0;
+            }
+        default:
+            return 0;
+    }
+}
+
+} // anonymous namespace
+
+struct ConcreteInterpreter::Program {
+    std::vector<std::string> names;                  ///< 槽位序号 -> 名字
+    std::unordered_map<std::string, size_t> slots;
+    std::vector<Block> blocks;
+    size_t entry = kNone;
+    std::vector<std::string> inputNames;
+
+    size_t slot(const std::string& name) {
+        auto it = slots.find(name);
+        if (it != slots.end()) {
+            return it->second;
+        }
+        slots[name] = names.size();
+        names.push_back(name);
+        return names.size() - 1;
+    }
+};
+
+// ============================================================================
+// ConcreteInterpreter 实现
+// ============================================================================
+
+ConcreteInterpreter::ConcreteInterpreter(LLIRModule* module) : module_(module) {}
+
+ConcreteInterpreter::~ConcreteInterpreter() = default;
+
+ConcreteInterpreter::Program* ConcreteInterpreter::prepare(const std::string& functionName) {
+    auto it = programs_.find(functionName);
+    if (it != programs_.end()) {
+        return it->second.get();
+    }
+
+    LLIRFunction* func = module_->getFunction(functionName);
+    if (!func) {
+        return nullptr;
+    }
+
+    auto program = std::make_unique<Program>();
+    const auto& basicBlocks = func->getBasicBlocks();
+    std::unordered_map<const LLIRBasicBlock*, size_t> blockIndex;
+    std::unordered_map<const LLIRInstruction*, std::string> resultNames;
+    for (size_t b = 0; b < basicBlocks.size(); ++b) {
+        blockIndex[basicBlocks[b]] = b;
+        const auto& instructions = basicBlocks[b]->getInstructions();
+        for (size_t i = 0; i < instructions.size(); ++i) {
+            resultNames[instructions[i]] = "%" + basicBlocks[b]->getName() + "." + std::to_string(i);
+        }
+    }
+    auto entryIt = blockIndex.find(func->getEntryBlock());
+    program->entry = entryIt != blockIndex.end() ? entryIt->second : kNone;
+
+    // 名字与引擎的 operandToExpr / cellName 相同
+    auto valueName = [&](LLIRValue* value) -> std::string {
+        if (auto* inst = dynamic_cast<LLIRInstruction*>(value)) {
+            auto found = resultNames.find(inst);
+            return found != resultNames.end() ? found->second : "";
+        }
+        if (auto* var = dynamic_cast<LLIRVariable*>(value)) {
+            return var->getName();
+        }
+        if (auto* arg = dynamic_cast<LLIRArgument*>(value)) {
+            return arg->getName();
+        }
+        if (auto* global = dynamic_cast<LLIRGlobalVariable*>(value)) {
+            return global->getName();
+        }
+        return "";
+    };
+    auto cellName = [&](LLIRValue* ptr) -> std::string {
+        std::string name = valueName(ptr);
+        return name.empty() ? "" : "*" + name;
+    };
+
+    std::set<std::string> read;
+    std::set<std::string> computed;
+    auto operand = [&](LLIRValue* value) {
+        Operand result;
+        if (auto* constant = dynamic_cast<LLIRConstant*>(value)) {
+            result.value = constant->isInteger() ? constant->getIntValue() : 0;
+            return result;
+        }
+        std::string name = value ? valueName(value) : "";
+        if (!name.empty()) {
+            result.slot = program->slot(name);
+            read.insert(name);
+        }
+        return result;
+    };
+    auto target = [&](LLIRValue* value) {
+        auto* name = dynamic_cast<LLIRVariable*>(value);
+        auto* bb = name ? func->getBasicBlock(name->getName()) : nullptr;
+        return bb ? blockIndex[bb] : kNone;
+    };
+
+    for (auto* bb : basicBlocks) {
+        Block block;
+        bool terminated = false;
+
+        for (auto* inst : bb->getInstructions()) {
+            if (!inst) {
+                continue;
+            }
+            const auto& operands = inst->getOperands();
+
+            if (computesResult(inst)) {
+                Op op;
+                op.type = inst->getType();
+                op.predicate = inst->getPredicate();
+                op.lhs = operand(operands[0]);
+                op.rhs = operand(operands[1]);
+                op.dst = program->slot(resultNames[inst]);
+                computed.insert(resultNames[inst]);
+                block.ops.push_back(op);
+            } else if (inst->getType() == LLIRInstructionType::Load) {
+                std::string cell = operands.empty() ? "" : cellName(operands[0]);
+                if (!cell.empty()) {
+                    Op op;
+                    op.type = LLIRInstructionType::Load;
+                    op.lhs.slot = program->slot(cell);
+                    op.dst = program->slot(resultNames[inst]);
+                    read.insert(cell);
+                    computed.insert(resultNames[inst]);
+                    block.ops.push_back(op);
+                }
+            } else if (inst->getType() == LLIRInstructionType::Store) {
+                std::string cell = operands.size() == 2 ? cellName(operands[1]) : "";
+                if (!cell.empty()) {
+                    Op op;
+                    op.type = LLIRInstructionType::Store;
+                    op.lhs = operand(operands[0]);
+                    op.dst = program->slot(cell);
+                    block.ops.push_back(op);
+                }
+            } else if (inst->getType() == LLIRInstructionType::Br) {
+                block.branch = inst;
+                if (operands.size() == 3) {
+                    block.operand = operand(operands[0]);
+                    block.targets[0] = target(operands[1]);
+                    block.targets[1] = target(operands[2]);
+                    // 目标无法解析时与 JIT 后端一样，记录走向后返回
+                    if (block.targets[0] == kNone || block.targets[1] == kNone) {
+                        block.targets[0] = block.targets[1] = kNone;
+                    }
+                    block.terminator = Terminator::CondBr;
+                } else {
+                    size_t dest = operands.empty() ? kNone : target(operands[0]);
+                    if (dest == kNone && !bb->getSuccessors().empty()) {
+                        dest = blockIndex[bb->getSuccessors()[0]];
+                    }
+                    block.terminator = Terminator::Jump;
+                    block.targets[0] = dest;
+                }
+                terminated = true;
+            } else if (inst->getType() == LLIRInstructionType::Ret) {
+                block.terminator = Terminator::Ret;
+                if (!operands.empty()) {
+                    block.operand = operand(operands[0]);
+                }
+                terminated = true;
+            }
+
+            if (terminated) {
+                break;
+            }
+        }
+
+        // 没有终结指令：顺序执行到第一个后继，没有后继时返回
+        if (!terminated && !bb->getSuccessors().empty()) {
+            block.terminator = Terminator::Jump;
+            block.targets[0] = blockIndex[bb->getSuccessors()[0]];
+        }
+        program->blocks.push_back(std::move(block));
+    }
+
+    for (const auto& name : read) {
+        if (!computed.count(name)) {
+            program->inputNames.push_back(name);
+        }
+    }
+
+    return (programs_[functionName] = std::move(program)).get();
+}
+
+ConcreteResult ConcreteInterpreter::run(
+    const std::string& functionName,
+    const std::unordered_map<std::string, int64_t>& inputs,
+    size_t maxBranches
+) {
+    ConcreteResult result;
+    Program* program = prepare(functionName);
+    if (!program) {
+        return result;
+    }
+
+    std::vector<int64_t> slots(program->names.size(), 0);
+    for (const auto& [name, value] : inputs) {
+        auto it = program->slots.find(name);
+        if (it != program->slots.end()) {
+            slots[it->second] = value;
+        }
+    }
+    auto read = [&slots](const Operand& operand) {
+        return operand.slot == kNone ? operand.value : slots[operand.slot];
+    };
+
+    size_t remaining = maxBranches;
+    size_t current = program->entry;
+    while (current != kNone) {
+        const Block& block = program->blocks[current];
+        for (const Op& op : block.ops) {
+            switch (op.type) {
+                case LLIRInstructionType::Load:  slots[op.dst] = slots[op.lhs.slot]; break;
+                case LLIRInstructionType::Store: slots[op.dst] = read(op.lhs); break;
+                default: slots[op.dst] = evaluate(op, read(op.lhs), read(op.rhs)); break;
+            }
+        }
+
+        if (block.terminator == Terminator::Ret) {
+            result.returnValue = read(block.operand);
+            break;
+        }
+        if (block.terminator == Terminator::Exit) {
+            break;
+        }
+
+        if (remaining == 0) {
+            result.truncated = true;
+            break;
+        }
+        --remaining;
+
+        if (block.terminator == Terminator::CondBr) {
+            size_t successor = read(block.operand) != 0 ? 0 : 1;
+            result.branches.push_back({block.branch, successor});
+            current = block.targets[successor];
+        } else {
+            current = block.targets[0];
+        }
+    }
+    result.completed = !result.truncated;
+
+    for (size_t i = 0; i < program->names.size(); ++i) {
+        if (program->names[i][0] == '*') {
+            result.cells[program->names[i]] = slots[i];
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> ConcreteInterpreter::getInputNames(const std::string& functionName) {
+    Program* program = prepare(functionName);
+    return program ? program->inputNames : std::vector<std::string>{};
+}
+
+} // namespace core
+} // namespace cverifier
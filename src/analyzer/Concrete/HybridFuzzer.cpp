@@ -0,0 +1,170 @@
+/**
+ * @file HybridFuzzer.cpp
+ * @brief 覆盖引导的变异循环实现
+ */
+
+#include "cverifier/HybridFuzzer.h"
+#include "cverifier/LLIRValue.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+#include <limits>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+/// 一次变异最多修改的输入个数（实际为 1、2 或 4 个）
+constexpr int kMaxStackedMutationsLog2 = 2;
+
+/// 小幅增减的范围（与 AFL 的 arith 阶段相同）
+constexpr int kArithRange = 35;
+
+/// 边界附近的特殊值
+const int64_t kInterestingValues[] = {
+    0, 1, -1, 2, 16, 32, 64, 100, 127, -128, 128, 255, 256, 512, 1000, 1024, 4096,
+    32767, -32768, 65535, 65536,
+    std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(),
+    std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// HybridFuzzer 实现
+// ============================================================================
+
+HybridFuzzer::HybridFuzzer(LLIRModule* module, const std::string& functionName, size_t maxBranches)
+    : functionName_(functionName), maxBranches_(maxBranches),
+      interpreter_(std::make_unique<ConcreteInterpreter>(module)) {
+    if (NativeExecutor::isSupported()) {
+        native_ = std::make_unique<NativeExecutor>(module);
+        if (!native_->compile(functionName)) {
+            utils::Logger::debug("Native execution unavailable for " + functionName + ": " +
+                                 native_->getLastError());
+            native_.reset();
+        }
+    }
+
+    inputNames_ = interpreter_->getInputNames(functionName);
+
+    if (LLIRFunction* func = module->getFunction(functionName)) {
+        for (auto* bb : func->getBasicBlocks()) {
+            for (auto* inst : bb->getInstructions()) {
+                if (!inst) {
+                    continue;
+                }
+                for (LLIRValue* operand : inst->getOperands()) {
+                    auto* constant = dynamic_cast<LLIRConstant*>(operand);
+                    if (constant && constant->isInteger()) {
+                        int64_t value = constant->getIntValue();
+                        dictionary_.push_back(value);
+                        dictionary_.push_back(static_cast<int64_t>(static_cast<uint64_t>(value) + 1));
+                        dictionary_.push_back(static_cast<int64_t>(static_cast<uint64_t>(value) - 1));
+                    }
+                }
+            }
+        }
+    }
+    std::sort(dictionary_.begin(), dictionary_.end());
+    dictionary_.erase(std::unique(dictionary_.begin(), dictionary_.end()), dictionary_.end());
+}
+
+bool HybridFuzzer::execute(const ConcreteInputs& inputs, bool fromSolver) {
+    ConcreteResult result = native_
+        ? native_->run(functionName_, inputs, maxBranches_)
+        : interpreter_->run(functionName_, inputs, maxBranches_);
+    ++executions_;
+
+    bool progress = false;
+    for (const BranchEvent& event : result.branches) {
+        progress = covered_.insert({event.branch, event.successor}).second || progress;
+    }
+
+    if (!progress) {
+        ++sinceProgress_;
+        return false;
+    }
+    sinceProgress_ = 0;
+    corpus_.push_back({inputs, std::move(result), fromSolver});
+    return true;
+}
+
+bool HybridFuzzer::fuzzOne() {
+    if (corpus_.empty()) {
+        return execute({});
+    }
+    const FuzzSeed& seed = corpus_[static_cast<size_t>(
+        utils::Random::nextInt(0, static_cast<int>(corpus_.size()) - 1))];
+    return execute(mutate(seed.inputs));
+}
+
+ConcreteInputs HybridFuzzer::mutate(const ConcreteInputs& inputs) {
+    ConcreteInputs mutated = inputs;
+    if (inputNames_.empty()) {
+        return mutated;
+    }
+
+    auto pickName = [this]() -> const std::string& {
+        return inputNames_[static_cast<size_t>(
+            utils::Random::nextInt(0, static_cast<int>(inputNames_.size()) - 1))];
+    };
+
+    int count = 1 << utils::Random::nextInt(0, kMaxStackedMutationsLog2);
+    for (int i = 0; i < count; ++i) {
+        int64_t& value = mutated[pickName()];
+        auto bits = static_cast<uint64_t>(value);
+        switch (utils::Random::nextInt(0, 6)) {
+            case 0:
+                value = static_cast<int64_t>(bits ^ (uint64_t{1} << utils::Random::nextInt(0, 63)));
+                break;
+            case 1:
+                value = static_cast<int64_t>(
+                    bits + static_cast<uint64_t>(utils::Random::nextInt(-kArithRange, kArithRange)));
+                break;
+            case 2: {
+                constexpr int numInteresting = sizeof(kInterestingValues) / sizeof(kInterestingValues[0]);
+                value = kInterestingValues[utils::Random::nextInt(0, numInteresting - 1)];
+                break;
+            }
+            case 3:
+                if (!dictionary_.empty()) {
+                    value = dictionary_[static_cast<size_t>(
+                        utils::Random::nextInt(0, static_cast<int>(dictionary_.size()) - 1))];
+                }
+                break;
+            case 4:
+                value = utils::Random::nextInt(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+                break;
+            case 5: {
+                // 两个输入相等或相关的分支（i == n）靠复制越过
+                auto other = mutated.find(pickName());
+                value = other != mutated.end() ? other->second : 0;
+                break;
+            }
+            default:
+                value = static_cast<int64_t>(0 - bits);
+                break;
+        }
+    }
+    return mutated;
+}
+
+std::vector<FrontierBranch> HybridFuzzer::takeFrontier() {
+    // 按语料库和分支序列的顺序收集，结果与指针值无关
+    std::vector<FrontierBranch> frontier;
+    for (size_t s = 0; s < corpus_.size(); ++s) {
+        const auto& branches = corpus_[s].result.branches;
+        for (size_t e = 0; e < branches.size(); ++e) {
+            Outcome other{branches[e].branch, 1 - branches[e].successor};
+            if (covered_.count(other) || !attempted_.insert(other).second) {
+                continue;
+            }
+            frontier.push_back({other.first, other.second, s, e});
+        }
+    }
+    return frontier;
+}
+
+} // namespace core
+} // namespace cverifier
@@ -0,0 +1,548 @@
+/**
+ * @file NativeExecutor.cpp
+ * @brief LLIR 到 LLVM IR 的降低和 ORC JIT 具体执行
+ */
+
+#include "cverifier/NativeExecutor.h"
+#include "cverifier/LLIRValue.h"
+#include "cverifier/Utils.h"
+#include <sstream>
+
+#ifdef HAVE_LLVM
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/raw_ostream.h>
+#include <mutex>
+#endif
+
+namespace cverifier {
+namespace core {
+
+#ifdef HAVE_LLVM
+
+namespace {
+
+/// 分支回调的符号名：参数为 (运行上下文, 分支序号, 后继序号)，无条件分支的后继为 -1，
+/// 返回非零时函数立即结束
+constexpr const char* kBranchCallback = "cverifier_native_branch";
+
+/// 编译后的入口：slots 按槽位序号存放输入，返回前把存储单元的值写回
+using NativeEntry = int64_t (*)(int64_t* slots, void* context);
+
+/**
+ * @brief 一次运行的上下文（通过入口的第二个参数传给分支回调）
+ */
+struct RunContext {
+    const std::vector<const LLIRInstruction*>* branches;
+    ConcreteResult* result;
+    size_t remaining;   ///< 还能执行的分支指令数
+};
+
+int32_t onBranch(void* context, int64_t branch, int64_t successor) {
+    auto* run = static_cast<RunContext*>(context);
+    if (run->remaining == 0) {
+        run->result->truncated = true;
+        return 1;
+    }
+    --run->remaining;
+    if (successor >= 0) {
+        run->result->branches.push_back({(*run->branches)[static_cast<size_t>(branch)],
+                                         static_cast<size_t>(successor)});
+    }
+    return 0;
+}
+
+/**
+ * @brief 降低时确定的名字布局
+ */
+struct FunctionLayout {
+    std::vector<std::string> names;                  ///< 槽位序号 -> 名字
+    std::unordered_map<std::string, size_t> slots;   ///< 名字 -> 槽位序号
+    std::vector<const LLIRInstruction*> branches;    ///< 分支序号 -> 分支指令
+    std::unordered_map<const LLIRInstruction*, std::string> resultNames;
+
+    size_t slot(const std::string& name) {
+        auto it = slots.find(name);
+        if (it != slots.end()) {
+            return it->second;
+        }
+        slots[name] = names.size();
+        names.push_back(name);
+        return names.size() - 1;
+    }
+
+    /// 与引擎的 operandToExpr 相同的命名；常量和无法命名的值返回空
+    std::string valueName(LLIRValue* value) const {
+        if (auto* inst = dynamic_cast<LLIRInstruction*>(value)) {
+            auto it = resultNames.find(inst);
+            return it != resultNames.end() ? it->second : "";
+        }
+        if (auto* var = dynamic_cast<LLIRVariable*>(value)) {
+            return var->getName();
+        }
+        if (auto* arg = dynamic_cast<LLIRArgument*>(value)) {
+            return arg->getName();
+        }
+        if (auto* global = dynamic_cast<LLIRGlobalVariable*>(value)) {
+            return global->getName();
+        }
+        return "";
+    }
+
+    /// 与引擎的 cellName 相同：指针操作数对应的存储单元
+    std::string cellName(LLIRValue* ptr) const {
+        std::string name = valueName(ptr);
+        return name.empty() ? "" : "*" + name;
+    }
+};
+
+/**
+ * @brief 把 LLIR 函数降低为入口函数 symbol
+ *
+ * 每个名字对应一个栈槽，在入口处从 slots 载入；mem2reg 会把它们提升为寄存器
+ */
+llvm::Function* lowerFunction(
+    LLIRFunction* func,
+    const std::string& symbol,
+    FunctionLayout& layout,
+    llvm::Module& module
+) {
+    llvm::LLVMContext& ctx = module.getContext();
+    llvm::IRBuilder<> builder(ctx);
+    llvm::Type* i64 = builder.getInt64Ty();
+    llvm::Type* opaquePtr = builder.getInt8PtrTy();
+
+    auto* fnType = llvm::FunctionType::get(i64, {llvm::PointerType::getUnqual(i64), opaquePtr}, false);
+    auto* fn = llvm::Function::Create(fnType, llvm::Function::ExternalLinkage, symbol, module);
+    llvm::Value* slotsArg = fn->getArg(0);
+    llvm::Value* contextArg = fn->getArg(1);
+    llvm::FunctionCallee callback = module.getOrInsertFunction(
+        kBranchCallback, llvm::FunctionType::get(builder.getInt32Ty(), {opaquePtr, i64, i64}, false));
+
+    for (auto* bb : func->getBasicBlocks()) {
+        const auto& instructions = bb->getInstructions();
+        for (size_t i = 0; i < instructions.size(); ++i) {
+            layout.resultNames[instructions[i]] = "%" + bb->getName() + "." + std::to_string(i);
+        }
+    }
+
+    auto* init = llvm::BasicBlock::Create(ctx, "init", fn);
+    std::unordered_map<const LLIRBasicBlock*, llvm::BasicBlock*> blocks;
+    for (auto* bb : func->getBasicBlocks()) {
+        blocks[bb] = llvm::BasicBlock::Create(ctx, bb->getName(), fn);
+    }
+    auto* abort = llvm::BasicBlock::Create(ctx, "abort", fn);
+    auto* exit = llvm::BasicBlock::Create(ctx, "exit", fn);
+
+    builder.SetInsertPoint(exit);
+    llvm::PHINode* returnValue = builder.CreatePHI(i64, 0, "ret");
+    builder.SetInsertPoint(abort);
+    builder.CreateBr(exit);
+    returnValue->addIncoming(builder.getInt64(0), abort);
+
+    builder.SetInsertPoint(init);
+    auto entryIt = blocks.find(func->getEntryBlock());
+    llvm::Instruction* initEnd = builder.CreateBr(entryIt != blocks.end() ? entryIt->second : exit);
+    if (entryIt == blocks.end()) {
+        returnValue->addIncoming(builder.getInt64(0), init);
+    }
+
+    // 名字第一次出现时在入口分配栈槽并载入输入
+    std::unordered_map<std::string, llvm::AllocaInst*> vars;
+    llvm::IRBuilder<> initBuilder(initEnd);
+    auto var = [&](const std::string& name) {
+        auto it = vars.find(name);
+        if (it != vars.end()) {
+            return it->second;
+        }
+        llvm::AllocaInst* alloca = initBuilder.CreateAlloca(i64, nullptr, name);
+        llvm::Value* input = initBuilder.CreateConstGEP1_64(i64, slotsArg, layout.slot(name));
+        initBuilder.CreateStore(initBuilder.CreateLoad(i64, input), alloca);
+        vars[name] = alloca;
+        return alloca;
+    };
+    auto operand = [&](LLIRValue* value) -> llvm::Value* {
+        if (auto* constant = dynamic_cast<LLIRConstant*>(value)) {
+            return builder.getInt64(constant->isInteger() ? constant->getIntValue() : 0);
+        }
+        std::string name = value ? layout.valueName(value) : "";
+        if (name.empty()) {
+            return builder.getInt64(0);
+        }
+        return builder.CreateLoad(i64, var(name));
+    };
+    auto target = [&](LLIRValue* value) -> llvm::BasicBlock* {
+        auto* name = dynamic_cast<LLIRVariable*>(value);
+        auto* bb = name ? func->getBasicBlock(name->getName()) : nullptr;
+        return bb ? blocks[bb] : nullptr;
+    };
+
+    // 分支先回调运行时，回调要求停止时转到 abort
+    auto emitBranchCallback = [&](const LLIRInstruction* inst, llvm::Value* successor) {
+        size_t id = layout.branches.size();
+        layout.branches.push_back(inst);
+        llvm::Value* stop = builder.CreateCall(callback, {contextArg, builder.getInt64(id), successor});
+        auto* cont = llvm::BasicBlock::Create(ctx, "cont", fn, exit);
+        builder.CreateCondBr(builder.CreateICmpNE(stop, builder.getInt32(0)), abort, cont);
+        builder.SetInsertPoint(cont);
+    };
+    auto emitJump = [&](const LLIRInstruction* inst, llvm::BasicBlock* dest) {
+        emitBranchCallback(inst, builder.getInt64(-1));
+        if (dest) {
+            builder.CreateBr(dest);
+        } else {
+            returnValue->addIncoming(builder.getInt64(0), builder.GetInsertBlock());
+            builder.CreateBr(exit);
+        }
+    };
+
+    for (auto* bb : func->getBasicBlocks()) {
+        builder.SetInsertPoint(blocks[bb]);
+        bool terminated = false;
+
+        for (auto* inst : bb->getInstructions()) {
+            if (!inst) {
+                continue;
+            }
+            const auto& operands = inst->getOperands();
+            auto assign = [&](llvm::Value* value) {
+                builder.CreateStore(value, var(layout.resultNames[inst]));
+            };
+
+            switch (inst->getType()) {
+                case LLIRInstructionType::Add:
+                case LLIRInstructionType::Sub:
+                case LLIRInstructionType::Mul:
+                case LLIRInstructionType::And:
+                case LLIRInstructionType::Or:
+                case LLIRInstructionType::Xor:
+                case LLIRInstructionType::Shl:
+                case LLIRInstructionType::Shr:
+                case LLIRInstructionType::Div:
+                case LLIRInstructionType::Rem: {
+                    if (operands.size() != 2) {
+                        break;
+                    }
+                    llvm::Value* lhs = operand(operands[0]);
+                    llvm::Value* rhs = operand(operands[1]);
+                    llvm::Value* shift = builder.CreateAnd(rhs, builder.getInt64(63));
+                    llvm::Value* result = nullptr;
+                    switch (inst->getType()) {
+                        case LLIRInstructionType::Add: result = builder.CreateAdd(lhs, rhs); break;
+                        case LLIRInstructionType::Sub: result = builder.CreateSub(lhs, rhs); break;
+                        case LLIRInstructionType::Mul: result = builder.CreateMul(lhs, rhs); break;
+                        case LLIRInstructionType::And: result = builder.CreateAnd(lhs, rhs); break;
+                        case LLIRInstructionType::Or:  result = builder.CreateOr(lhs, rhs); break;
+                        case LLIRInstructionType::Xor: result = builder.CreateXor(lhs, rhs); break;
+                        case LLIRInstructionType::Shl: result = builder.CreateShl(lhs, shift); break;
+                        case LLIRInstructionType::Shr: result = builder.CreateAShr(lhs, shift); break;
+                        default: {
+                            // 除数为 0 时结果为 0；除数为 -1 时单独计算，避免 INT64_MIN / -1 溢出陷阱
+                            bool isDiv = inst->getType() == LLIRInstructionType::Div;
+                            llvm::Value* isZero = builder.CreateICmpEQ(rhs, builder.getInt64(0));
+                            llvm::Value* isMinusOne = builder.CreateICmpEQ(rhs, builder.getInt64(-1));
+                            llvm::Value* safe = builder.CreateSelect(
+                                builder.CreateOr(isZero, isMinusOne), builder.getInt64(1), rhs);
+                            llvm::Value* quotient = isDiv ? builder.CreateSDiv(lhs, safe)
+                                                          : builder.CreateSRem(lhs, safe);
+                            llvm::Value* byMinusOne = isDiv ? builder.CreateNeg(lhs) : builder.getInt64(0);
+                            result = builder.CreateSelect(isZero, builder.getInt64(0),
+                                builder.CreateSelect(isMinusOne, byMinusOne, quotient));
+                            break;
+                        }
+                    }
+                    assign(result);
+                    break;
+                }
+
+                case LLIRInstructionType::ICmp: {
+                    // 没有谓词的比较与引擎一样是自由值，从输入中取
+                    llvm::CmpInst::Predicate predicate;
+                    switch (inst->getPredicate()) {
+                        case LLIRCmpPredicate::EQ: predicate = llvm::CmpInst::ICMP_EQ; break;
+                        case LLIRCmpPredicate::NE: predicate = llvm::CmpInst::ICMP_NE; break;
+                        case LLIRCmpPredicate::LT: predicate = llvm::CmpInst::ICMP_SLT; break;
+                        case LLIRCmpPredicate::LE: predicate = llvm::CmpInst::ICMP_SLE; break;
+                        case LLIRCmpPredicate::GT: predicate = llvm::CmpInst::ICMP_SGT; break;
+                        case LLIRCmpPredicate::GE: predicate = llvm::CmpInst::ICMP_SGE; break;
+                        default: predicate = llvm::CmpInst::BAD_ICMP_PREDICATE; break;
+                    }
+                    if (operands.size() == 2 && predicate != llvm::CmpInst::BAD_ICMP_PREDICATE) {
+                        llvm::Value* cmp = builder.CreateICmp(predicate, operand(operands[0]), operand(operands[1]));
+                        assign(builder.CreateZExt(cmp, i64));
+                    }
+                    break;
+                }
+
+                case LLIRInstructionType::Load: {
+                    std::string cell = operands.empty() ? "" : layout.cellName(operands[0]);
+                    if (!cell.empty()) {
+                        assign(builder.CreateLoad(i64, var(cell)));
+                    }
+                    break;
+                }
+
+                case LLIRInstructionType::Store: {
+                    std::string cell = operands.size() == 2 ? layout.cellName(operands[1]) : "";
+                    if (!cell.empty()) {
+                        builder.CreateStore(operand(operands[0]), var(cell));
+                    }
+                    break;
+                }
+
+                case LLIRInstructionType::Br: {
+                    if (operands.size() == 3) {
+                        llvm::Value* taken = builder.CreateICmpNE(operand(operands[0]), builder.getInt64(0));
+                        emitBranchCallback(inst, builder.CreateSelect(taken, builder.getInt64(0), builder.getInt64(1)));
+                        llvm::BasicBlock* thenBlock = target(operands[1]);
+                        llvm::BasicBlock* elseBlock = target(operands[2]);
+                        if (thenBlock && elseBlock) {
+                            builder.CreateCondBr(taken, thenBlock, elseBlock);
+                        } else {
+                            returnValue->addIncoming(builder.getInt64(0), builder.GetInsertBlock());
+                            builder.CreateBr(exit);
+                        }
+                    } else {
+                        llvm::BasicBlock* dest = operands.empty() ? nullptr : target(operands[0]);
+                        if (!dest && !bb->getSuccessors().empty()) {
+                            dest = blocks[bb->getSuccessors()[0]];
+                        }
+                        emitJump(inst, dest);
+                    }
+                    terminated = true;
+                    break;
+                }
+
+                case LLIRInstructionType::Ret: {
+                    llvm::Value* value = operands.empty() ? builder.getInt64(0) : operand(operands[0]);
+                    returnValue->addIncoming(value, builder.GetInsertBlock());
+                    builder.CreateBr(exit);
+                    terminated = true;
+                    break;
+                }
+
+                default:
+                    // 其他指令（调用、GEP、alloca 等）的结果与引擎一样是自由值
+                    break;
+            }
+
+            if (terminated) {
+                break;
+            }
+        }
+
+        // 没有终结指令：与 CFG 一样顺序执行到第一个后继，没有后继时返回
+        if (!terminated) {
+            llvm::BasicBlock* dest = bb->getSuccessors().empty() ? nullptr : blocks[bb->getSuccessors()[0]];
+            if (dest) {
+                emitJump(nullptr, dest);
+            } else {
+                returnValue->addIncoming(builder.getInt64(0), builder.GetInsertBlock());
+                builder.CreateBr(exit);
+            }
+        }
+    }
+
+    // 出口：存储单元的值写回 slots（名字在降低完成后才全部确定）
+    builder.SetInsertPoint(exit);
+    for (const auto& [name, alloca] : vars) {
+        if (name[0] == '*') {
+            builder.CreateStore(builder.CreateLoad(i64, alloca),
+                                builder.CreateConstGEP1_64(i64, slotsArg, layout.slots[name]));
+        }
+    }
+    builder.CreateRet(returnValue);
+    return fn;
+}
+
+void optimizeModule(llvm::Module& module) {
+    llvm::LoopAnalysisManager lam;
+    llvm::FunctionAnalysisManager fam;
+    llvm::CGSCCAnalysisManager cgam;
+    llvm::ModuleAnalysisManager mam;
+
+    llvm::PassBuilder builder;
+    builder.registerModuleAnalyses(mam);
+    builder.registerCGSCCAnalyses(cgam);
+    builder.registerFunctionAnalyses(fam);
+    builder.registerLoopAnalyses(lam);
+    builder.crossRegisterProxies(lam, fam, cgam, mam);
+    builder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2).run(module, mam);
+}
+
+} // anonymous namespace
+
+struct NativeExecutor::Impl {
+    struct CompiledFunction {
+        FunctionLayout layout;
+        NativeEntry entry = nullptr;
+    };
+
+    std::unique_ptr<llvm::orc::LLJIT> jit;
+    std::unordered_map<std::string, std::unique_ptr<CompiledFunction>> functions;
+};
+
+#else
+
+struct NativeExecutor::Impl {};
+
+#endif // HAVE_LLVM
+
+// ============================================================================
+// NativeExecutor 实现
+// ============================================================================
+
+NativeExecutor::NativeExecutor(LLIRModule* module)
+    : module_(module), impl_(std::make_unique<Impl>()) {}
+
+NativeExecutor::~NativeExecutor() = default;
+
+bool NativeExecutor::isSupported() {
+#ifdef HAVE_LLVM
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool NativeExecutor::compile(const std::string& functionName) {
+#ifdef HAVE_LLVM
+    if (impl_->functions.count(functionName)) {
+        return true;
+    }
+
+    LLIRFunction* func = module_->getFunction(functionName);
+    if (!func || !func->getEntryBlock()) {
+        lastError_ = "Function not found: " + functionName;
+        return false;
+    }
+
+    if (!impl_->jit) {
+        static std::once_flag targetInit;
+        std::call_once(targetInit, [] {
+            llvm::InitializeNativeTarget();
+            llvm::InitializeNativeTargetAsmPrinter();
+        });
+
+        auto jit = llvm::orc::LLJITBuilder().create();
+        if (!jit) {
+            lastError_ = llvm::toString(jit.takeError());
+            return false;
+        }
+
+        llvm::orc::SymbolMap runtime;
+        runtime[(*jit)->mangleAndIntern(kBranchCallback)] = llvm::JITEvaluatedSymbol(
+            llvm::pointerToJITTargetAddress(&onBranch), llvm::JITSymbolFlags::Exported);
+        if (auto err = (*jit)->getMainJITDylib().define(llvm::orc::absoluteSymbols(std::move(runtime)))) {
+            lastError_ = llvm::toString(std::move(err));
+            return false;
+        }
+        impl_->jit = std::move(*jit);
+    }
+
+    auto compiled = std::make_unique<Impl::CompiledFunction>();
+    auto context = std::make_unique<llvm::LLVMContext>();
+    auto module = std::make_unique<llvm::Module>(functionName, *context);
+    module->setDataLayout(impl_->jit->getDataLayout());
+
+    std::string symbol = "cverifier_native_fn" + std::to_string(compiledFunctions_);
+    llvm::Function* fn = lowerFunction(func, symbol, compiled->layout, *module);
+
+    std::string verifyErrors;
+    llvm::raw_string_ostream verifyStream(verifyErrors);
+    if (llvm::verifyFunction(*fn, &verifyStream)) {
+        lastError_ = "Invalid lowering of " + functionName + ": " + verifyStream.str();
+        return false;
+    }
+    optimizeModule(*module);
+
+    if (auto err = impl_->jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(context)))) {
+        lastError_ = llvm::toString(std::move(err));
+        return false;
+    }
+
+    auto address = impl_->jit->lookup(symbol);
+    if (!address) {
+        lastError_ = llvm::toString(address.takeError());
+        return false;
+    }
+#if LLVM_VERSION_MAJOR >= 15
+    compiled->entry = address->toPtr<NativeEntry>();
+#else
+    compiled->entry = reinterpret_cast<NativeEntry>(address->getAddress());
+#endif
+
+    utils::Logger::debug("JIT-compiled function " + functionName + " (" +
+                         std::to_string(compiled->layout.names.size()) + " slots, " +
+                         std::to_string(compiled->layout.branches.size()) + " branches)");
+    impl_->functions[functionName] = std::move(compiled);
+    ++compiledFunctions_;
+    return true;
+#else
+    lastError_ = "Native execution requires LLVM (built without HAVE_LLVM)";
+    (void)functionName;
+    return false;
+#endif
+}
+
+ConcreteResult NativeExecutor::run(
+    const std::string& functionName,
+    const std::unordered_map<std::string, int64_t>& inputs,
+    size_t maxBranches
+) {
+    ConcreteResult result;
+    if (!compile(functionName)) {
+        return result;
+    }
+
+#ifdef HAVE_LLVM
+    const Impl::CompiledFunction& compiled = *impl_->functions[functionName];
+    const FunctionLayout& layout = compiled.layout;
+
+    std::vector<int64_t> slots(layout.names.size(), 0);
+    for (const auto& [name, value] : inputs) {
+        auto it = layout.slots.find(name);
+        if (it != layout.slots.end()) {
+            slots[it->second] = value;
+        }
+    }
+
+    RunContext context{&layout.branches, &result, maxBranches};
+    result.returnValue = compiled.entry(slots.data(), &context);
+    result.completed = !result.truncated;
+
+    for (size_t i = 0; i < layout.names.size(); ++i) {
+        if (layout.names[i][0] == '*') {
+            result.cells[layout.names[i]] = slots[i];
+        }
+    }
+
+    ++runs_;
+    truncatedRuns_ += result.truncated ? 1 : 0;
+    recordedBranches_ += result.branches.size();
+#else
+    (void)inputs;
+    (void)maxBranches;
+#endif
+    return result;
+}
+
+std::string NativeExecutor::getStatistics() const {
+    std::ostringstream oss;
+    oss << "Native Execution Statistics:\n";
+    oss << "  Compiled Functions: " << compiledFunctions_ << "\n";
+    oss << "  Runs: " << runs_ << "\n";
+    oss << "  Truncated Runs: " << truncatedRuns_ << "\n";
+    oss << "  Recorded Branches: " << recordedBranches_ << "\n";
+    return oss.str();
+}
+
+} // namespace core
+} // namespace cverifier
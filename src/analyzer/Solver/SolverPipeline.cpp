@@ -0,0 +1,164 @@
+/**
+ * @file SolverPipeline.cpp
+ * @brief 异步求解流水线实现
+ */
+
+#include "cverifier/SolverPipeline.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+#include <sstream>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// SolverPipeline 实现
+// ============================================================================
+
+SolverPipeline::SolverPipeline(
+    size_t numWorkers,
+    CancellationToken* token,
+    unsigned int timeoutMs,
+    unsigned int resourceLimit
+) {
+    numWorkers = std::max<size_t>(numWorkers, 1);
+
+    // 求解器在当前线程上依次创建：Z3 的全局参数表惰性初始化，并发创建上下文不安全
+    solvers_.reserve(numWorkers);
+    for (size_t i = 0; i < numWorkers; ++i) {
+        auto solver = std::make_unique<Z3Solver>();
+        solver->setTimeout(timeoutMs);
+        solver->setResourceLimit(resourceLimit);
+        solver->setCancellationToken(token);
+        solvers_.push_back(std::move(solver));
+    }
+
+    workers_.reserve(numWorkers);
+    for (auto& solver : solvers_) {
+        workers_.emplace_back(&SolverPipeline::workerLoop, this, solver.get());
+    }
+
+    utils::Logger::debug("Solver pipeline started with " +
+                         std::to_string(numWorkers) + " workers");
+}
+
+SolverPipeline::~SolverPipeline() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+        queries_.clear();
+    }
+    queryReady_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+SolverTicket SolverPipeline::submit(std::vector<Expr*> constraints) {
+    SolverTicket ticket;
+    ExprEpoch::Pin pin = ExprEpoch::pin();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ticket = nextTicket_++;
+        queries_.push_back({ticket, std::move(constraints), std::move(pin)});
+        ++outstanding_;
+        ++submitted_;
+    }
+    queryReady_.notify_one();
+    return ticket;
+}
+
+bool SolverPipeline::tryCollect(SolverCompletion& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (results_.empty()) {
+        return false;
+    }
+
+    out = results_.front();
+    results_.pop_front();
+    --outstanding_;
+    return true;
+}
+
+bool SolverPipeline::waitCollect(SolverCompletion& out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (outstanding_ == 0) {
+        return false;
+    }
+
+    utils::Timer stall;
+    resultReady_.wait(lock, [this]() { return !results_.empty(); });
+    stallMs_ += stall.elapsedMs();
+
+    out = results_.front();
+    results_.pop_front();
+    --outstanding_;
+    return true;
+}
+
+size_t SolverPipeline::outstanding() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return outstanding_;
+}
+
+void SolverPipeline::workerLoop(Z3Solver* solver) {
+    while (true) {
+        Query query;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queryReady_.wait(lock, [this]() { return shutdown_ || !queries_.empty(); });
+            if (shutdown_) {
+                return;
+            }
+            query = std::move(queries_.front());
+            queries_.pop_front();
+        }
+
+        PathConstraint constraints;
+        for (Expr* expr : query.constraints) {
+            constraints.add(expr);
+        }
+
+        utils::Timer timer;
+        SolverCompletion completion;
+        completion.ticket = query.ticket;
+        completion.result = solver->check(&constraints);
+        completion.solverMs = timer.elapsedMs();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            switch (completion.result) {
+                case SolverResult::Sat: ++satCount_; break;
+                case SolverResult::Unsat: ++unsatCount_; break;
+                default: ++unknownCount_; break;
+            }
+            totalSolverMs_ += completion.solverMs;
+            maxSolverMs_ = std::max(maxSolverMs_, completion.solverMs);
+            results_.push_back(completion);
+        }
+        resultReady_.notify_one();
+    }
+}
+
+std::string SolverPipeline::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream oss;
+
+    oss << "Solver Pipeline Statistics:\n";
+    oss << "  Workers: " << workers_.size() << "\n";
+    oss << "  Queries: " << submitted_
+        << " (sat " << satCount_
+        << ", unsat " << unsatCount_
+        << ", unknown " << unknownCount_ << ")\n";
+    oss << std::fixed;
+    oss << "  Solver Time: " << totalSolverMs_ << "ms (max " << maxSolverMs_ << "ms)\n";
+    oss << "  Explorer Stall: " << stallMs_ << "ms\n";
+
+    return oss.str();
+}
+
+} // namespace core
+} // namespace cverifier
@@ -19,33 +19,60 @@ Z3Solver::Z3Solver()
 #ifdef HAVE_Z3
     : ctx_(), solver_(ctx_, "QF_LIA")
 #endif
-    , timeout_(5000) {
+    , timeout_(5000)
+    , resourceLimit_(0)
+    , cancelToken_(nullptr)
+    , interruptHandle_(0) {
 #ifdef HAVE_Z3
     // 设置超时（使用 Z3_params）
-    Z3_params params = Z3_mk_params(ctx_);
-    Z3_symbol symbol = Z3_mk_string_symbol(ctx_, "timeout");
-    Z3_params_set_uint(ctx_, params, symbol, static_cast<unsigned>(timeout_));
-    Z3_solver_set_params(ctx_, solver_, params);
-    Z3_params_dec_ref(ctx_, params);
+    setTimeout(timeout_);
 
     utils::Logger::debug("Z3 solver initialized successfully");
 #else
     utils::Logger::warning("Z3 not available. Using simplified solver implementation.");
 #endif
+
+    setCancellationToken(CancellationToken::current());
 }
 
 Z3Solver::~Z3Solver() {
+    // 先注销中断处理器，保证上下文销毁后不会再被中断
+    setCancellationToken(nullptr);
 #ifdef HAVE_Z3
     // Z3对象会自动清理
 #endif
 }
 
+void Z3Solver::interrupt() {
+#ifdef HAVE_Z3
+    Z3_interrupt(ctx_);
+#endif
+}
+
+void Z3Solver::setCancellationToken(CancellationToken* token) {
+    if (cancelToken_) {
+        cancelToken_->removeInterruptHandler(interruptHandle_);
+        interruptHandle_ = 0;
+    }
+
+    cancelToken_ = token;
+
+    if (cancelToken_) {
+        interruptHandle_ = cancelToken_->addInterruptHandler([this]() { interrupt(); });
+    }
+}
+
 SolverResult Z3Solver::check(const PathConstraint* constraints) {
 #ifdef HAVE_Z3
     if (!constraints) {
         return SolverResult::Error;
     }
 
+    // 已取消：中断信号可能早于本次查询到达，直接放弃
+    if (cancelToken_ && cancelToken_->isCancelled()) {
+        return SolverResult::Unknown;
+    }
+
     try {
         // 清除之前的断言
         solver_.reset();
@@ -113,6 +140,10 @@ SolverResult Z3Solver::check(Expr* expr) {
         return SolverResult::Error;
     }
 
+    if (cancelToken_ && cancelToken_->isCancelled()) {
+        return SolverResult::Unknown;
+    }
+
     try {
         solver_.reset();
         z3::expr z3Expr = convertToZ3(expr);
@@ -139,6 +170,10 @@ SolverResult Z3Solver::check(Expr* expr) {
 bool Z3Solver::isValid(Expr* expr) {
     // 表达式是永真的，当且仅当其否定不可满足
 #ifdef HAVE_Z3
+    if (cancelToken_ && cancelToken_->isCancelled()) {
+        return false;
+    }
+
     try {
         solver_.reset();
 
@@ -164,9 +199,24 @@ CounterExample Z3Solver::getModel() const {
 
 void Z3Solver::setTimeout(unsigned int milliseconds) {
     timeout_ = milliseconds;
+    applyParams();
+}
+
+void Z3Solver::setResourceLimit(unsigned int limit) {
+    resourceLimit_ = limit;
+    applyParams();
+}
+
+void Z3Solver::applyParams() {
 #ifdef HAVE_Z3
-    // Z3需要在创建时设置超时，这里仅记录
-    // 实际超时设置在下次创建solver时生效
+    // 超时和资源上限作为求解器参数设置，对之后的所有查询生效
+    // Z3_mk_params 返回的引用计数为 0，必须先 inc_ref 再 dec_ref
+    Z3_params params = Z3_mk_params(ctx_);
+    Z3_params_inc_ref(ctx_, params);
+    Z3_params_set_uint(ctx_, params, Z3_mk_string_symbol(ctx_, "timeout"), timeout_);
+    Z3_params_set_uint(ctx_, params, Z3_mk_string_symbol(ctx_, "rlimit"), resourceLimit_);
+    Z3_solver_set_params(ctx_, solver_, params);
+    Z3_params_dec_ref(ctx_, params);
 #endif
 }
 
@@ -209,6 +259,9 @@ std::string Z3Solver::getStatistics() const {
 #ifdef HAVE_Z3
     oss << "Z3 Solver Statistics:\n";
     oss << "  Timeout: " << timeout_ << "ms\n";
+    if (resourceLimit_ > 0) {
+        oss << "  Resource Limit: " << resourceLimit_ << "\n";
+    }
 
     try {
         Z3_stats z3Stats = Z3_solver_get_statistics(ctx_, solver_);
@@ -317,6 +370,12 @@ z3::expr Z3Solver::convertToZ3(Expr* expr) {
             break;
         }
 
+        case ExprType::Ite: {
+            auto* ite = static_cast<IteExpr*>(expr);
+            return z3::ite(convertToZ3(ite->getCondition()), convertToZ3(ite->getThen()),
+                           convertToZ3(ite->getElse()));
+        }
+
         default:
             break;
     }
@@ -0,0 +1,103 @@
+/**
+ * @file AbstractReachabilityTree.cpp
+ * @brief 抽象可达树实现
+ */
+
+#include "cverifier/AbstractReachabilityTree.h"
+#include <algorithm>
+
+namespace cverifier {
+namespace core {
+
+AbstractReachabilityTree::AbstractReachabilityTree(CFGNode* root) {
+    auto node = std::make_unique<ArtNode>();
+    node->location = root;
+    byLocation_[root].push_back(node.get());
+    nodes_.push_back(std::move(node));
+}
+
+ArtNode* AbstractReachabilityTree::addChild(ArtNode* parent, CFGNode* location, size_t succIndex) {
+    auto node = std::make_unique<ArtNode>();
+    node->location = location;
+    node->parent = parent;
+    node->succIndex = succIndex;
+    node->id = nodes_.size();
+    node->depth = parent->depth + 1;
+    parent->children.push_back(node.get());
+    byLocation_[location].push_back(node.get());
+    nodes_.push_back(std::move(node));
+    return nodes_.back().get();
+}
+
+std::vector<ArtNode*> AbstractReachabilityTree::pathTo(ArtNode* node) const {
+    std::vector<ArtNode*> path;
+    for (ArtNode* n = node; n; n = n->parent) {
+        path.push_back(n);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+const std::vector<ArtNode*>& AbstractReachabilityTree::nodesAt(const CFGNode* location) const {
+    static const std::vector<ArtNode*> empty;
+    auto it = byLocation_.find(location);
+    return it != byLocation_.end() ? it->second : empty;
+}
+
+bool AbstractReachabilityTree::isCovered(const ArtNode* node) const {
+    for (; node; node = node->parent) {
+        if (node->coveredBy) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AbstractReachabilityTree::cover(ArtNode* node, ArtNode* by, std::vector<ArtNode*>& uncovered) {
+    auto isDescendant = [node](const ArtNode* other) {
+        for (; other; other = other->parent) {
+            if (other == node) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (auto it = coveredNodes_.begin(); it != coveredNodes_.end();) {
+        if (!isDescendant(it->first)) {
+            ++it;
+            continue;
+        }
+        for (ArtNode* covered : it->second) {
+            covered->coveredBy = nullptr;
+            uncovered.push_back(covered);
+        }
+        it = coveredNodes_.erase(it);
+    }
+
+    node->coveredBy = by;
+    coveredNodes_[by].push_back(node);
+}
+
+void AbstractReachabilityTree::uncoverBy(ArtNode* node, std::vector<ArtNode*>& uncovered) {
+    auto it = coveredNodes_.find(node);
+    if (it == coveredNodes_.end()) {
+        return;
+    }
+    for (ArtNode* covered : it->second) {
+        covered->coveredBy = nullptr;
+        uncovered.push_back(covered);
+    }
+    coveredNodes_.erase(it);
+}
+
+size_t AbstractReachabilityTree::getNumCovered() const {
+    size_t covered = 0;
+    for (const auto& [by, nodes] : coveredNodes_) {
+        covered += nodes.size();
+    }
+    return covered;
+}
+
+} // namespace core
+} // namespace cverifier
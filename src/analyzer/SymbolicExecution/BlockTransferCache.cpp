@@ -0,0 +1,138 @@
+/**
+ * @file BlockTransferCache.cpp
+ * @brief 基本块转移缓存实现
+ */
+
+#include "cverifier/BlockTransferCache.h"
+#include <sstream>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+/// 新鲜符号占位名的前缀和结束符：调用者可能在名称后追加后缀（如 "_cmp"）
+constexpr const char* kFreshPrefix = "$fresh";
+constexpr char kFreshEnd = '$';
+
+} // anonymous namespace
+
+// ============================================================================
+// TransferSubstitution 实现
+// ============================================================================
+
+std::string TransferSubstitution::applyName(const std::string& name) const {
+    static const std::string prefix = kFreshPrefix;
+    if (name.compare(0, prefix.size(), prefix) != 0) {
+        return name;
+    }
+
+    size_t end = name.find(kFreshEnd, prefix.size());
+    if (end == std::string::npos) {
+        return name;
+    }
+
+    size_t index = std::stoul(name.substr(prefix.size(), end - prefix.size()));
+    if (index >= freshNames_.size()) {
+        return name;
+    }
+    return freshNames_[index] + name.substr(end + 1);
+}
+
+Expr* TransferSubstitution::apply(Expr* expr) {
+    if (!expr) {
+        return nullptr;
+    }
+
+    auto it = memo_.find(expr);
+    if (it != memo_.end()) {
+        return it->second;
+    }
+
+    Expr* result = expr;
+    switch (expr->getType()) {
+        case ExprType::Variable: {
+            auto* var = static_cast<VariableExpr*>(expr);
+            std::string name = applyName(var->getName());
+            if (name != var->getName()) {
+                result = new VariableExpr(name);
+            }
+            break;
+        }
+        case ExprType::BinaryOp: {
+            auto* binary = static_cast<BinaryOpExpr*>(expr);
+            Expr* left = apply(binary->getLeft());
+            Expr* right = apply(binary->getRight());
+            if (left != binary->getLeft() || right != binary->getRight()) {
+                result = new BinaryOpExpr(binary->getOp(), left, right);
+            }
+            break;
+        }
+        case ExprType::UnaryOp: {
+            auto* unary = static_cast<UnaryOpExpr*>(expr);
+            Expr* operand = apply(unary->getOperand());
+            if (operand != unary->getOperand()) {
+                result = new UnaryOpExpr(unary->getOp(), operand);
+            }
+            break;
+        }
+        case ExprType::Ite: {
+            auto* ite = static_cast<IteExpr*>(expr);
+            Expr* cond = apply(ite->getCondition());
+            Expr* thenExpr = apply(ite->getThen());
+            Expr* elseExpr = apply(ite->getElse());
+            if (cond != ite->getCondition() || thenExpr != ite->getThen() ||
+                elseExpr != ite->getElse()) {
+                result = new IteExpr(cond, thenExpr, elseExpr);
+            }
+            break;
+        }
+        default:
+            // 常量等叶子节点不含占位符，直接共享
+            break;
+    }
+
+    memo_[expr] = result;
+    return result;
+}
+
+// ============================================================================
+// BlockTransferCache 实现
+// ============================================================================
+
+const BlockTransfer* BlockTransferCache::lookup(const LLIRBasicBlock* bb, bool& known) const {
+    auto it = transfers_.find(bb);
+    known = it != transfers_.end();
+    return known ? it->second.get() : nullptr;
+}
+
+const BlockTransfer* BlockTransferCache::insert(
+    const LLIRBasicBlock* bb,
+    std::unique_ptr<BlockTransfer> transfer
+) {
+    if (transfer) {
+        ++summarized_;
+    } else {
+        ++uncacheable_;
+    }
+
+    auto& slot = transfers_[bb];
+    slot = std::move(transfer);
+    return slot.get();
+}
+
+std::string BlockTransferCache::freshPlaceholder(size_t index) {
+    return kFreshPrefix + std::to_string(index) + kFreshEnd;
+}
+
+std::string BlockTransferCache::getStatistics() const {
+    std::ostringstream oss;
+    oss << "Block Transfer Cache Statistics:\n";
+    oss << "  Summarized Blocks: " << summarized_ << "\n";
+    oss << "  Uncacheable Blocks: " << uncacheable_ << "\n";
+    oss << "  Hits: " << hits_ << "\n";
+    return oss.str();
+}
+
+} // namespace core
+} // namespace cverifier
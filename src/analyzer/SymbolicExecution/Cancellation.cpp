@@ -0,0 +1,70 @@
+/**
+ * @file Cancellation.cpp
+ * @brief 协作式取消令牌实现
+ */
+
+#include "cverifier/Cancellation.h"
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+thread_local CancellationToken* currentToken = nullptr;
+
+} // anonymous namespace
+
+// ============================================================================
+// CancellationToken 实现
+// ============================================================================
+
+void CancellationToken::cancel() {
+    cancelled_.store(true, std::memory_order_release);
+
+    // 持锁调用：保证处理器不会在注销之后被调用
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [handle, handler] : handlers_) {
+        if (handler) {
+            handler();
+        }
+    }
+}
+
+size_t CancellationToken::addInterruptHandler(InterruptHandler handler) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t handle = nextHandle_++;
+
+    // 注册晚于取消：立即中断，避免错过信号
+    if (isCancelled() && handler) {
+        handler();
+    }
+
+    handlers_[handle] = std::move(handler);
+    return handle;
+}
+
+void CancellationToken::removeInterruptHandler(size_t handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    handlers_.erase(handle);
+}
+
+CancellationToken* CancellationToken::current() {
+    return currentToken;
+}
+
+// ============================================================================
+// CancellationScope 实现
+// ============================================================================
+
+CancellationScope::CancellationScope(CancellationToken* token)
+    : previous_(currentToken) {
+    currentToken = token;
+}
+
+CancellationScope::~CancellationScope() {
+    currentToken = previous_;
+}
+
+} // namespace core
+} // namespace cverifier
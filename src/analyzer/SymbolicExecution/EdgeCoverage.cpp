@@ -0,0 +1,103 @@
+/**
+ * @file EdgeCoverage.cpp
+ * @brief 边覆盖位图实现
+ */
+
+#include "cverifier/EdgeCoverage.h"
+#include <algorithm>
+
+namespace cverifier {
+namespace core {
+
+EdgeCoverage::EdgeCoverage(CFG* cfg) {
+    // 按函数中基本块的顺序编号，编号在多次运行之间稳定
+    std::vector<const CFGNode*> nodes;
+    for (auto* bb : cfg->getFunction()->getBasicBlocks()) {
+        if (const CFGNode* node = cfg->getNode(bb->getName())) {
+            blockIndex_[node] = nodes.size();
+            nodes.push_back(node);
+        }
+    }
+
+    // 虚拟入口边
+    CFGNode* entry = cfg->getEntryNode();
+    auto entryIt = blockIndex_.find(entry);
+    edgeTarget_.push_back(entryIt != blockIndex_.end() ? entryIt->second : 0);
+
+    for (const CFGNode* node : nodes) {
+        firstEdge_[node] = edgeTarget_.size();
+        for (const CFGNode* succ : node->getSuccessors()) {
+            auto it = blockIndex_.find(succ);
+            edgeTarget_.push_back(it != blockIndex_.end() ? it->second : 0);
+        }
+    }
+
+    bitmap_.assign(edgeTarget_.size(), 0);
+    blockHits_.assign(nodes.size(), 0);
+}
+
+bool EdgeCoverage::edgeIndex(const CFGNode* from, const CFGNode* to, size_t& edge) const {
+    edge = 0;
+    if (!from) {
+        return true;
+    }
+    auto it = firstEdge_.find(from);
+    if (it == firstEdge_.end()) {
+        return false;
+    }
+    const auto& successors = from->getSuccessors();
+    auto pos = std::find(successors.begin(), successors.end(), to);
+    if (pos == successors.end()) {
+        return false;
+    }
+    edge = it->second + static_cast<size_t>(pos - successors.begin());
+    return true;
+}
+
+bool EdgeCoverage::isCovered(const CFGNode* from, const CFGNode* to) const {
+    size_t edge = 0;
+    return !edgeIndex(from, to, edge) || bitmap_[edge] != 0;
+}
+
+bool EdgeCoverage::visit(const CFGNode* from, const CFGNode* to) {
+    size_t edge = 0;
+    if (!edgeIndex(from, to, edge)) {
+        return false;
+    }
+
+    bool isNew = bitmap_[edge] == 0;
+    if (isNew) {
+        markEdge(edge);
+    } else if (bitmap_[edge] < UINT8_MAX) {
+        ++bitmap_[edge];
+    }
+    return isNew;
+}
+
+void EdgeCoverage::markEdge(size_t edge) {
+    if (edge >= bitmap_.size() || bitmap_[edge] != 0) {
+        return;
+    }
+
+    bitmap_[edge] = 1;
+    ++coveredEdges_;
+
+    size_t block = edgeTarget_[edge];
+    if (block < blockHits_.size() && !blockHits_[block]) {
+        blockHits_[block] = 1;
+        ++coveredBlocks_;
+    }
+}
+
+std::vector<size_t> EdgeCoverage::getCoveredEdges() const {
+    std::vector<size_t> edges;
+    for (size_t i = 0; i < bitmap_.size(); ++i) {
+        if (bitmap_[i] != 0) {
+            edges.push_back(i);
+        }
+    }
+    return edges;
+}
+
+} // namespace core
+} // namespace cverifier
@@ -4,14 +4,164 @@
  */
 
 #include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/ExprCodec.h"
+#include "cverifier/LLIRValue.h"
 #include "cverifier/Utils.h"
+#include "cverifier/Z3Solver.h"
 #include <sstream>
 #include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <limits>
 #include <random>
+#include <set>
 
 namespace cverifier {
 namespace core {
 
+namespace {
+
+/// 没有新报告时，每隔多少个基本块检查一次前沿是否还能到达未解决的义务
+constexpr int kObligationCheckInterval = 64;
+
+/// 区间求值递归的深度上限，更深的表达式不求区间
+constexpr uint32_t kMaxIntervalDepth = 4096;
+
+bool intervalMemo(const Expr* expr, int64_t& lo, int64_t& hi,
+                  std::unordered_map<const Expr*, std::pair<int64_t, int64_t>>& known,
+                  std::unordered_set<const Expr*>& unknown) {
+    if (unknown.count(expr)) {
+        return false;
+    }
+    auto it = known.find(expr);
+    if (it != known.end()) {
+        lo = it->second.first;
+        hi = it->second.second;
+        return true;
+    }
+
+    bool bounded = false;
+    if (auto* constant = dynamic_cast<const ConstantExpr*>(expr)) {
+        lo = hi = constant->getValue();
+        bounded = true;
+    } else if (isBooleanExpr(expr)) {
+        lo = 0;
+        hi = 1;
+        bounded = true;
+    } else if (auto* ite = dynamic_cast<const IteExpr*>(expr)) {
+        int64_t lo2, hi2;
+        bounded = intervalMemo(ite->getThen(), lo, hi, known, unknown) &&
+                  intervalMemo(ite->getElse(), lo2, hi2, known, unknown);
+        if (bounded) {
+            lo = std::min(lo, lo2);
+            hi = std::max(hi, hi2);
+        }
+    } else if (auto* unary = dynamic_cast<const UnaryOpExpr*>(expr)) {
+        int64_t l, h;
+        bounded = unary->getOp() == UnaryOpType::Neg &&
+                  intervalMemo(unary->getOperand(), l, h, known, unknown) &&
+                  l > std::numeric_limits<int64_t>::min();
+        if (bounded) {
+            lo = -h;
+            hi = -l;
+        }
+    } else if (auto* binary = dynamic_cast<const BinaryOpExpr*>(expr)) {
+        int64_t l1, h1, l2, h2;
+        bool left = intervalMemo(binary->getLeft(), l1, h1, known, unknown);
+        bool right = intervalMemo(binary->getRight(), l2, h2, known, unknown);
+        switch (binary->getOp()) {
+            case BinaryOpType::Add:
+                bounded = left && right &&
+                          !__builtin_add_overflow(l1, l2, &lo) && !__builtin_add_overflow(h1, h2, &hi);
+                break;
+            case BinaryOpType::Sub:
+                bounded = left && right &&
+                          !__builtin_sub_overflow(l1, h2, &lo) && !__builtin_sub_overflow(h1, l2, &hi);
+                break;
+            case BinaryOpType::Mul: {
+                int64_t products[4];
+                bounded = left && right &&
+                          !__builtin_mul_overflow(l1, l2, &products[0]) &&
+                          !__builtin_mul_overflow(l1, h2, &products[1]) &&
+                          !__builtin_mul_overflow(h1, l2, &products[2]) &&
+                          !__builtin_mul_overflow(h1, h2, &products[3]);
+                if (bounded) {
+                    lo = *std::min_element(products, products + 4);
+                    hi = *std::max_element(products, products + 4);
+                }
+                break;
+            }
+            case BinaryOpType::Rem:
+                // 余数的绝对值小于除数的绝对值，不依赖被除数
+                bounded = right && l2 == h2 && l2 != 0 && l2 > std::numeric_limits<int64_t>::min();
+                if (bounded) {
+                    hi = (l2 < 0 ? -l2 : l2) - 1;
+                    lo = left && l1 >= 0 && l2 > 0 ? 0 : -hi;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (!bounded) {
+        unknown.insert(expr);
+        return false;
+    }
+    known[expr] = {lo, hi};
+    return true;
+}
+
+/**
+ * @brief 表达式取值区间：常量、布尔值以及它们的加减乘、取余、取负和条件选择，
+ *        含自由符号或可能溢出时返回 false
+ */
+bool exprInterval(const Expr* expr, int64_t& lo, int64_t& hi) {
+    if (expr->getDepth() > kMaxIntervalDepth) {
+        return false;
+    }
+    std::unordered_map<const Expr*, std::pair<int64_t, int64_t>> known;
+    std::unordered_set<const Expr*> unknown;
+    return intervalMemo(expr, lo, hi, known, unknown);
+}
+
+/**
+ * @brief 分支条件的真假：比较两侧的取值区间不重叠或都是同一常量时可以判定
+ * @return 1 恒真，0 恒假，-1 不能判定
+ */
+int guardTruth(const Expr* guard) {
+    if (auto* constant = dynamic_cast<const ConstantExpr*>(guard)) {
+        return constant->getValue() != 0 ? 1 : 0;
+    }
+    if (auto* unary = dynamic_cast<const UnaryOpExpr*>(guard)) {
+        if (unary->getOp() != UnaryOpType::LNot) {
+            return -1;
+        }
+        int truth = guardTruth(unary->getOperand());
+        return truth < 0 ? -1 : 1 - truth;
+    }
+
+    auto* binary = dynamic_cast<const BinaryOpExpr*>(guard);
+    int64_t l1, h1, l2, h2;
+    if (!binary || !exprInterval(binary->getLeft(), l1, h1) ||
+        !exprInterval(binary->getRight(), l2, h2)) {
+        return -1;
+    }
+    bool equal = l1 == h1 && l2 == h2 && l1 == l2;
+    bool disjoint = h1 < l2 || h2 < l1;
+    switch (binary->getOp()) {
+        case BinaryOpType::EQ: return equal ? 1 : disjoint ? 0 : -1;
+        case BinaryOpType::NE: return disjoint ? 1 : equal ? 0 : -1;
+        case BinaryOpType::LT: return h1 < l2 ? 1 : l1 >= h2 ? 0 : -1;
+        case BinaryOpType::LE: return h1 <= l2 ? 1 : l1 > h2 ? 0 : -1;
+        case BinaryOpType::GT: return l1 > h2 ? 1 : h1 <= l2 ? 0 : -1;
+        case BinaryOpType::GE: return l1 >= h2 ? 1 : h1 < l2 ? 0 : -1;
+        default: return -1;
+    }
+}
+
+} // anonymous namespace
+
 // ============================================================================
 // SymbolicExecutionEngine 实现
 // ============================================================================
@@ -21,25 +171,57 @@ SymbolicExecutionEngine::SymbolicExecutionEngine(
     const SymbolicExecutionConfig& config
 ) : module_(module),
     config_(config),
-    exploredPaths_(0),
+    reachedCount_(0),
+    currentCoverage_(nullptr),
+    obligationsChanged_(false),
+    recording_(nullptr),
+    currentExploration_(nullptr),
+    progressIntervalMs_(250),
+    currentCFG_(nullptr),
+    functionsCompleted_(0),
+    totalFunctions_(0),
     foundVulnerabilities_(0),
-    varCounter_(0) {
+    varCounter_(0),
+    splitFrontier_(0),
+    forkChannel_(-1) {
     // 记录开始时间点
     startTimer_ = utils::Timer();
+    configureGovernor();
+    configureSummaryStore();
+}
+
+bool SymbolicExecutionEngine::isTerminator(const LLIRInstruction* inst) {
+    return inst && (inst->getType() == LLIRInstructionType::Br ||
+                    inst->getType() == LLIRInstructionType::Ret);
+}
+
+std::string SymbolicExecutionEngine::conjunctionString(const std::vector<Expr*>& constraints) {
+    std::string condition = constraints.empty() ? "true" : "";
+    for (size_t i = 0; i < constraints.size(); ++i) {
+        condition += (i > 0 ? " && " : "") + constraints[i]->toString();
+    }
+    return condition;
 }
 
 SymbolicExecutionEngine::~SymbolicExecutionEngine() {
+    // 先停止求解线程，之后不会再有结果返回
+    solverPipeline_.reset();
+    proofPipeline_.reset();
+    for (auto& [ticket, explState] : parked_) {
+        worklist_.push_back(explState);
+    }
+    parked_.clear();
+
     // 清理工作列表
-    while (!worklist_.empty()) {
-        ExplorationState* explState = worklist_.front();
-        worklist_.pop();
-        if (explState) {
-            if (explState->symbolicState) {
-                delete explState->symbolicState;
-            }
-            delete explState;
-        }
+    discardWorklist();
+
+    // 清理挂起的函数
+    for (auto& fn : suspended_) {
+        worklist_ = std::move(fn.worklist);
+        discardWorklist();
+        delete fn.cfg;
     }
+    suspended_.clear();
 
     // 清理可达状态
     for (auto* state : reachedStates_) {
@@ -49,27 +231,184 @@ SymbolicExecutionEngine::~SymbolicExecutionEngine() {
     }
 }
 
+void SymbolicExecutionEngine::configureSummaryStore() {
+    if (config_.summaryDir.empty()) {
+        summaryStore_.reset();
+        return;
+    }
+
+    if (!summaryStore_ || summaryStore_->getDirectory() != config_.summaryDir) {
+        summaryStore_ = std::make_unique<SummaryStore>(config_.summaryDir);
+    }
+}
+
+uint64_t SymbolicExecutionEngine::configHash() const {
+    using utils::HashUtils;
+
+    // 只包含决定探索结果的配置；时间预算和线程数不影响已完成函数的结论
+    uint64_t hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.strategy));
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.maxDepth), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.maxStates), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enableStateMerging), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enablePathPruning), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enableLoopAcceleration), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enableGoalTermination), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.bmcBound), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.kInduction), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enableLazyAbstraction), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enableHybridFuzzing), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.fuzzPlateau), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enableStateDeduplication), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enableDeadBindingElimination), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.maxExprSize), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.maxExprDepth), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.exprBudgetPolicy), hash);
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(config_.enableLazyFork), hash);
+    return hash;
+}
+
+void SymbolicExecutionEngine::applySummary(const FunctionSummary& summary) {
+    utils::Logger::info("Reusing summary for function " + summary.function +
+                        " (" + summary.key.toString() + ", " +
+                        std::to_string(summary.reports.size()) + " reports)");
+
+    for (const auto& report : summary.reports) {
+        reports_.push_back(report);
+    }
+    foundVulnerabilities_ += static_cast<int>(summary.reports.size());
+    counters_.paths += summary.exploredPaths;
+}
+
+void SymbolicExecutionEngine::persistSummary() {
+    if (!summaryStore_ || !currentSummary_) {
+        return;
+    }
+
+    summaryStore_->store(*currentSummary_);
+    utils::Logger::debug("Stored summary for function " + currentSummary_->function);
+}
+
+void SymbolicExecutionEngine::recordReport(SymbolicState* state, VulnerabilityReport* report) {
+    foundVulnerabilities_++;
+    utils::Logger::error("Vulnerability found: " + report->toString());
+
+    // fork 子进程：立即发回，子进程之后崩溃也不会丢失
+    if (forkChannel_ >= 0) {
+        ForkExplorer::writeRecord(forkChannel_, "report " + FunctionSummary::encodeReport(*report));
+    }
+
+    if (currentSummary_) {
+        const auto& constraints = state->getPathConstraint()->getConstraints();
+        ExprEncoder encoder;
+        bool encoded = forkChannel_ >= 0;
+        for (size_t i = 0; encoded && i < constraints.size(); ++i) {
+            encoded = encoder.add(constraints[i]);
+        }
+        if (encoded) {
+            // fork 子进程：路径约束按表达式图发回（共享的子表达式只写一次），
+            // 由父进程生成前置条件
+            ForkExplorer::writeRecord(forkChannel_, "constraints " + FunctionSummary::escapeField(encoder.finish()));
+        } else {
+            FunctionSummary::addUnique(currentSummary_->preconditions, conjunctionString(constraints));
+        }
+        currentSummary_->reports.push_back(*report);
+    }
+
+    reports_.push_back(std::move(*report));
+    delete report;
+}
+
 void SymbolicExecutionEngine::run() {
+    // 本线程上创建的求解器自动接入取消令牌
+    CancellationScope scope(&cancelToken_);
+
     // 获取模块中的所有函数
     auto& functions = module_->getFunctions();
 
+    if (governor_) {
+        governor_->beginModule();
+    }
+
+    totalFunctions_ = functions.size();
+    functionsCompleted_ = 0;
+    progressTimer_.reset();
+
+    // 每个函数从剩余资源池中领取份额，提前结束的函数把预算留给后面的函数
+    size_t remaining = functions.size();
     for (auto* func : functions) {
-        runOnFunction(func->getName());
+        if (isStopped()) {
+            break;
+        }
+        exploreFunction(func->getName(), remaining--, true);
     }
+
+    // 预算耗尽的函数用其他函数剩下的预算继续探索
+    resumeSuspendedFunctions();
+
+    if (isStopped()) {
+        utils::Logger::warning("Symbolic execution cancelled");
+    }
+
+    reportProgress(true);
 }
 
 void SymbolicExecutionEngine::runOnFunction(const std::string& functionName) {
+    CancellationScope scope(&cancelToken_);
+
+    totalFunctions_ = 1;
+    functionsCompleted_ = 0;
+    progressTimer_.reset();
+
+    exploreFunction(functionName, 1, false);
+
+    reportProgress(true);
+}
+
+void SymbolicExecutionEngine::exploreFunction(
+    const std::string& functionName,
+    size_t remainingFunctions,
+    bool allowSuspend
+) {
+    if (isStopped()) {
+        return;
+    }
+
     auto* func = module_->getFunction(functionName);
     if (!func) {
         utils::Logger::warning("Function not found: " + functionName);
         return;
     }
 
+    // 内容和配置都相同的函数直接复用摘要，预算留给其他函数
+    if (summaryStore_) {
+        FunctionSummary summary;
+        SummaryKey key{SummaryStore::hashFunction(func), configHash()};
+        if (summaryStore_->lookup(key, summary)) {
+            applySummary(summary);
+            ++functionsCompleted_;
+            return;
+        }
+
+        currentSummary_ = std::make_unique<FunctionSummary>();
+        currentSummary_->function = functionName;
+        currentSummary_->key = key;
+    }
+
     utils::Logger::info("Starting symbolic execution for function: " + functionName);
 
+    // 路径预算丢弃过路径的函数不算完整探索（路径预算不在 configHash 中）
+    int prunedAtStart = counters_.prunedPaths;
+
     // 创建CFG
     utils::Logger::debug("Creating CFG for function: " + functionName);
     auto* cfg = new CFG(func);
+    nameInstructionResults(func);
+    if (config_.enableLoopAcceleration) {
+        loopAccelerator_ = std::make_unique<LoopAccelerator>(cfg);
+    }
+    if (config_.enableDeadBindingElimination) {
+        liveness_ = std::make_unique<LivenessAnalysis>(cfg, resultNames_);
+    }
 
     // 创建初始状态
     utils::Logger::debug("Creating initial symbolic state");
@@ -92,27 +431,338 @@ void SymbolicExecutionEngine::runOnFunction(const std::string& functionName) {
     auto* initialExplorationState = new ExplorationState(initialState, entryNode);
 
     utils::Logger::debug("Adding exploration state to worklist");
-    worklist_.push(initialExplorationState);
+    worklist_.push_back(initialExplorationState);
 
     utils::Logger::debug("Worklist size after push: " + std::to_string(worklist_.size()));
 
-    // 开始探索
-    explore();
+    if (config_.enableGoalTermination) {
+        obligations_ = std::make_unique<ObligationTracker>(cfg);
+        goalStats_.obligations += obligations_->size();
+    }
+
+    auto& coverage = coverage_[functionName];
+    coverage = std::make_unique<EdgeCoverage>(cfg);
+    currentCoverage_ = coverage.get();
+    searchContext_.bandit.restart();
+
+    if (governor_) {
+        governor_->beginFunction(functionName, remainingFunctions);
+    }
+
+    currentFunction_ = functionName;
+    currentCFG_ = cfg;
+    visitedNodes_.clear();
+    visitedStates_.clear();
+
+    if (config_.kInduction > 0) {
+        proveSafeSites();
+    }
+
+    // 开始探索（惰性抽象、有界模型检查和混合模糊测试不使用工作列表，初始状态随工作列表一起释放）
+    ExploreOutcome outcome;
+    if (config_.enableLazyAbstraction) {
+        outcome = exploreLazy();
+    } else if (config_.bmcBound > 0) {
+        outcome = exploreBounded();
+    } else if (config_.enableHybridFuzzing) {
+        outcome = exploreHybrid();
+    } else if (config_.forkWorkers > 0 && ForkExplorer::isSupported()) {
+        outcome = exploreForked();
+    } else {
+        outcome = explore();
+    }
+    loopAccelerator_.reset();
+    liveness_.reset();
+
+    if (outcome == ExploreOutcome::BudgetExhausted && allowSuspend && !worklist_.empty()) {
+        // 挂起：保留CFG和剩余前沿，等其他函数结束后用剩余预算继续
+        utils::Logger::info("Suspending function " + functionName + " with " +
+                            std::to_string(worklist_.size()) + " pending states");
+        suspended_.push_back({functionName, cfg, std::move(worklist_), std::move(visitedNodes_),
+                              std::move(visitedStates_), std::move(currentSummary_),
+                              std::move(obligations_), prunedAtStart});
+        worklist_ = {};
+    } else {
+        releaseObligations();
+        discardWorklist();
+        delete cfg;
+        ++functionsCompleted_;
+
+        // 只有完整探索的函数才能作为摘要复用
+        if (outcome == ExploreOutcome::Completed && counters_.prunedPaths == prunedAtStart && !isStopped()) {
+            persistSummary();
+        }
+    }
 
-    // 清理
-    delete cfg;
+    currentSummary_.reset();
+
+    currentCFG_ = nullptr;
+    currentCoverage_ = nullptr;
+    visitedNodes_.clear();
+    visitedStates_.clear();
+
+    if (governor_) {
+        governor_->endFunction();
+    }
 
     utils::Logger::info("Symbolic execution completed for function: " + functionName);
 }
 
-void SymbolicExecutionEngine::explore() {
+void SymbolicExecutionEngine::resumeSuspendedFunctions() {
+    // 只恢复一轮，保证终止
+    std::vector<SuspendedFunction> pending = std::move(suspended_);
+    suspended_.clear();
+
+    size_t remaining = pending.size();
+    bool aborted = false;
+
+    for (auto& fn : pending) {
+        worklist_ = std::move(fn.worklist);
+
+        if (!aborted && !isStopped()) {
+            utils::Logger::info("Resuming function " + fn.name + " with leftover budget");
+
+            currentFunction_ = fn.name;
+            currentCFG_ = fn.cfg;
+            visitedNodes_ = std::move(fn.visitedNodes);
+            visitedStates_ = std::move(fn.visitedStates);
+            currentSummary_ = std::move(fn.summary);
+            obligations_ = std::move(fn.obligations);
+            currentCoverage_ = coverage_[fn.name].get();
+            if (config_.enableLoopAcceleration) {
+                loopAccelerator_ = std::make_unique<LoopAccelerator>(fn.cfg);
+            }
+            if (config_.enableDeadBindingElimination) {
+                liveness_ = std::make_unique<LivenessAnalysis>(fn.cfg, resultNames_);
+            }
+
+            if (governor_) {
+                governor_->beginFunction(fn.name, remaining);
+            }
+
+            ExploreOutcome outcome = explore();
+            loopAccelerator_.reset();
+            liveness_.reset();
+            aborted = outcome == ExploreOutcome::Aborted;
+
+            if (outcome == ExploreOutcome::Completed && counters_.prunedPaths == fn.prunedAtStart &&
+                !isStopped()) {
+                persistSummary();
+            }
+            currentSummary_.reset();
+
+            if (governor_) {
+                governor_->endFunction();
+            }
+        }
+
+        --remaining;
+        ++functionsCompleted_;
+        releaseObligations();
+        discardWorklist();
+        delete fn.cfg;
+        currentCFG_ = nullptr;
+        currentCoverage_ = nullptr;
+        visitedNodes_.clear();
+        visitedStates_.clear();
+    }
+}
+
+void SymbolicExecutionEngine::discardWorklist() {
+    while (!worklist_.empty()) {
+        ExplorationState* explState = worklist_.front();
+        worklist_.pop_front();
+        if (explState) {
+            if (explState->symbolicState) {
+                delete explState->symbolicState;
+            }
+            delete explState;
+        }
+    }
+}
+
+void SymbolicExecutionEngine::reportProgress(bool force) {
+    if (!progressCallback_) {
+        return;
+    }
+
+    if (!force && progressTimer_.elapsedMs() < progressIntervalMs_) {
+        return;
+    }
+    progressTimer_.reset();
+
+    ExplorationProgress progress;
+    progress.function = currentFunction_;
+    progress.functionsCompleted = functionsCompleted_;
+    progress.totalFunctions = totalFunctions_;
+    progress.elapsedSec = startTimer_.elapsedSec();
+    progress.reachedStates = reachedCount_ + forkStats_.states;
+    if (progress.elapsedSec > 0.0) {
+        progress.statesPerSec = progress.reachedStates / progress.elapsedSec;
+    }
+    progress.frontierSize = worklist_.size() + parked_.size();
+    if (currentCFG_ && !currentCFG_->getNodes().empty()) {
+        progress.coverage = static_cast<double>(visitedNodes_.size()) /
+                            currentCFG_->getNodes().size();
+    }
+    progress.exploredPaths = counters_.paths;
+    progress.reportsFound = foundVulnerabilities_;
+    progress.finished = force;
+    progress.cancelled = isStopped();
+
+    progressCallback_(progress);
+}
+
+void SymbolicExecutionEngine::parkForFeasibility(ExplorationState* explorationState) {
+    const auto& constraints =
+        explorationState->symbolicState->getPathConstraint()->getConstraints();
+
+    SolverTicket ticket = solverPipeline_->submit(constraints);
+    parked_[ticket] = explorationState;
+
+    utils::Logger::debug("Parked state at " + explorationState->currentNode->getId() +
+                         " (ticket " + std::to_string(ticket) + ")");
+}
+
+void SymbolicExecutionEngine::collectSolverResults(bool block) {
+    if (parked_.empty()) {
+        return;
+    }
+
+    // 没有流水线（已停止或从未创建）时结果不会再到达：状态带着待求解标记
+    // 回到工作列表，由主循环同步求解，避免等待永远不会完成的票据
+    if (!solverPipeline_) {
+        for (auto& entry : parked_) {
+            worklist_.push_back(entry.second);
+        }
+        parked_.clear();
+        return;
+    }
+
+    SolverCompletion completion;
+    if (block && solverPipeline_->waitCollect(completion)) {
+        resumeParkedState(completion);
+    }
+
+    while (solverPipeline_->tryCollect(completion)) {
+        resumeParkedState(completion);
+    }
+}
+
+void SymbolicExecutionEngine::resumeParkedState(const SolverCompletion& completion) {
+    auto it = parked_.find(completion.ticket);
+    if (it == parked_.end()) {
+        return;
+    }
+
+    ExplorationState* explorationState = it->second;
+    parked_.erase(it);
+
+    explorationState->usage.solverMs += completion.solverMs;
+    if (governor_) {
+        governor_->chargeSolverTime(completion.solverMs);
+    }
+
+    if (feasibilityCache_) {
+        feasibilityCache_->insert(*explorationState->symbolicState->getPathConstraint(),
+                                  completion.result != SolverResult::Unsat);
+    }
+
+    // 只有明确不可满足才剪枝；Unknown/Error 时保守地继续探索
+    if (completion.result == SolverResult::Unsat) {
+        utils::Logger::debug("Path pruned, skipping state");
+        counters_.infeasiblePaths++;
+        delete explorationState->symbolicState;
+        delete explorationState;
+        return;
+    }
+
+    explorationState->needsFeasibilityCheck = false;
+    worklist_.push_back(explorationState);
+}
+
+void SymbolicExecutionEngine::drainParkedStates() {
+    while (!parked_.empty()) {
+        collectSolverResults(true);
+    }
+}
+
+void SymbolicExecutionEngine::sortWorklistByPath() {
+    std::stable_sort(worklist_.begin(), worklist_.end(),
+                     [](const ExplorationState* a, const ExplorationState* b) {
+                         return a->pathId < b->pathId;
+                     });
+}
+
+uint64_t SymbolicExecutionEngine::stateKey(const ExplorationState* explorationState) {
+    using utils::HashUtils;
+
+    // 节点在函数结束前不会释放，visitedStates_ 按函数清空，地址可以直接作为程序点
+    uint64_t hash = HashUtils::fnv1a(reinterpret_cast<uintptr_t>(explorationState->currentNode));
+    hash = HashUtils::fnv1a(static_cast<uint64_t>(explorationState->instructionIndex), hash);
+    return HashUtils::fnv1a(explorationState->symbolicState->getFingerprint(), hash);
+}
+
+template <typename Searcher, typename Solver>
+SymbolicExecutionEngine::ExploreOutcome SymbolicExecutionEngine::exploreWith() {
     utils::Logger::info("Starting path exploration with " +
                        std::to_string(worklist_.size()) + " initial states");
 
     utils::Logger::debug("About to enter exploration loop");
 
+    // 确定性模式总是经过流水线求解，用 Z3 资源上限代替墙钟超时，
+    // 这样结果与求解线程数无关
+    if (config_.enablePathPruning && !solverPipeline_) {
+        if (config_.deterministic) {
+            solverPipeline_ = std::make_unique<SolverPipeline>(
+                static_cast<size_t>(std::max(config_.solverThreads, 1)), &cancelToken_,
+                std::numeric_limits<unsigned int>::max(), kDeterministicSolverRlimit);
+        } else if (config_.solverThreads > 0) {
+            solverPipeline_ = std::make_unique<SolverPipeline>(
+                static_cast<size_t>(config_.solverThreads), &cancelToken_);
+        }
+    }
+
+    searchContext_.coverage = currentCoverage_;
+    searchContext_.deterministic = config_.deterministic;
+
+    ExploreOutcome outcome = ExploreOutcome::Completed;
     int iterations = 0;
-    while (!worklist_.empty()) {
+    obligationsChanged_ = obligations_ != nullptr;
+    while (!worklist_.empty() || !parked_.empty()) {
+        // 取消请求：状态留在工作列表中，由调用者统一清理
+        if (cancelToken_.isCancelled()) {
+            utils::Logger::info("Exploration cancelled");
+            outcome = ExploreOutcome::Aborted;
+            break;
+        }
+
+        if (config_.deterministic) {
+            // 确定性模式：就绪状态耗尽时才等待全部求解结果，按路径前缀顺序放回，
+            // 探索顺序与求解完成的先后无关
+            if (worklist_.empty()) {
+                drainParkedStates();
+                sortWorklistByPath();
+                continue;
+            }
+        } else {
+            // 求解完成的状态回到工作列表；没有就绪状态时才阻塞等待求解器
+            collectSolverResults(worklist_.empty());
+            if (worklist_.empty()) {
+                continue;
+            }
+        }
+
+        // fork 模式：前沿足够宽时停止，剩余子树交给子进程
+        if (splitFrontier_ > 0 && worklist_.size() >= splitFrontier_) {
+            outcome = ExploreOutcome::FrontierSplit;
+            break;
+        }
+
+        if (config_.enableExprReclamation && exprHeap_.shouldCollect()) {
+            collectExprs();
+        }
+
         ++iterations;
 
         utils::Logger::debug("Iteration " + std::to_string(iterations) +
@@ -121,10 +771,7 @@ void SymbolicExecutionEngine::explore() {
         utils::Logger::debug("Fetching exploration state from worklist");
 
         // 从工作列表中取出一个状态
-        ExplorationState* explorationState = worklist_.front();
-
-        utils::Logger::debug("Got exploration state, popping from worklist");
-        worklist_.pop();
+        ExplorationState* explorationState = Searcher::select(worklist_, searchContext_);
 
         utils::Logger::debug("Extracting state and node from exploration state");
 
@@ -141,45 +788,220 @@ void SymbolicExecutionEngine::explore() {
 
         utils::Logger::debug("Processing node: " + node->getId());
 
-        // 路径剪枝检查
-        if (config_.enablePathPruning && shouldPrunePath(state)) {
-            utils::Logger::debug("Path pruned, skipping state");
-            delete state;
-            delete explorationState;
-            continue;
+        // 同一程序点已执行过相同的状态：后续执行完全相同，在求解之前丢弃。
+        // 键在真正执行时才记录，挂起求解或放回前沿的状态再次取出时不会误判
+        uint64_t key = 0;
+        if (config_.enableStateDeduplication) {
+            key = stateKey(explorationState);
+            if (visitedStates_.count(key)) {
+                utils::Logger::debug("Duplicate state at " + node->getId() + ", skipping state");
+                counters_.duplicateStates++;
+                delete state;
+                delete explorationState;
+                continue;
+            }
+        }
+
+        // 相同约束集合已有结论时不再求解
+        if constexpr (Solver::kCached) {
+            bool satisfiable = true;
+            if (config_.enablePathPruning && explorationState->needsFeasibilityCheck &&
+                feasibilityCache_->lookup(*state->getPathConstraint(), satisfiable)) {
+                explorationState->needsFeasibilityCheck = false;
+                if (!satisfiable) {
+                    utils::Logger::debug("Path pruned by feasibility cache, skipping state");
+                    counters_.infeasiblePaths++;
+                    delete state;
+                    delete explorationState;
+                    continue;
+                }
+            }
         }
 
-        // 检查超时
+        // 路径剪枝检查：只有新增了分支约束的状态需要求解
+        if (config_.enablePathPruning && explorationState->needsFeasibilityCheck) {
+            if (solverPipeline_) {
+                // 异步求解：状态挂起，探索线程继续执行其他就绪状态
+                parkForFeasibility(explorationState);
+                continue;
+            }
+
+            explorationState->needsFeasibilityCheck = false;
+            utils::Timer solverTimer;
+            bool prune = shouldPrunePath(state);
+            if constexpr (Solver::kCached) {
+                feasibilityCache_->insert(*state->getPathConstraint(), !prune);
+            }
+            double solverMs = solverTimer.elapsedMs();
+            explorationState->usage.solverMs += solverMs;
+            if (governor_) {
+                governor_->chargeSolverTime(solverMs);
+            }
+
+            if (prune) {
+                utils::Logger::debug("Path pruned, skipping state");
+                counters_.infeasiblePaths++;
+                delete state;
+                delete explorationState;
+                continue;
+            }
+        }
+
+        // 检查超时（确定性模式只受状态数和步数限制）
         double elapsed = startTimer_.elapsedSec();
-        if (elapsed > config_.timeout) {
+        if (!config_.deterministic && elapsed > config_.timeout) {
             utils::Logger::warning("Symbolic execution timeout");
             delete state;
             delete explorationState;
+            outcome = ExploreOutcome::Aborted;
             break;
         }
 
         // 检查状态数限制
-        if (reachedStates_.size() >= static_cast<size_t>(config_.maxStates)) {
+        if (reachedCount_ >= static_cast<size_t>(config_.maxStates)) {
             utils::Logger::warning("Maximum number of states reached");
+            delete state;
+            delete explorationState;
+            outcome = ExploreOutcome::Aborted;
             break;
         }
 
+        if (governor_) {
+            // 函数预算耗尽：把状态放回前沿，由调用者决定挂起还是丢弃
+            BudgetVerdict verdict = governor_->checkFunction();
+            if (verdict != BudgetVerdict::Ok) {
+                utils::Logger::warning(std::string("Function budget exhausted (") +
+                                       ResourceGovernor::verdictToString(verdict) + ")");
+                worklist_.push_back(explorationState);
+                outcome = ExploreOutcome::BudgetExhausted;
+                break;
+            }
+
+            // 路径预算耗尽：只放弃这一条路径
+            verdict = governor_->checkPath(explorationState->usage);
+            if (verdict != BudgetVerdict::Ok) {
+                utils::Logger::debug(std::string("Path budget exhausted (") +
+                                     ResourceGovernor::verdictToString(verdict) + ")");
+                counters_.prunedPaths++;
+                delete state;
+                delete explorationState;
+                continue;
+            }
+        }
+
+        // 同时在求解中的相同状态只执行第一个
+        if (config_.enableStateDeduplication && !visitedStates_.insert(key).second) {
+            utils::Logger::debug("Duplicate state at " + node->getId() + ", skipping state");
+            counters_.duplicateStates++;
+            delete state;
+            delete explorationState;
+            continue;
+        }
+
+        // 边覆盖：在状态真正执行时记录转移，被剪枝的分支不算覆盖
+        if (currentCoverage_ && explorationState->instructionIndex == 0) {
+            explorationState->newCoverage =
+                currentCoverage_->visit(explorationState->previousNode, node);
+        }
+
         // 执行基本块
+        explorationState->usage.steps++;
+        currentExploration_ = explorationState;
+        stepTimer_.reset();
+        int reportsBefore = foundVulnerabilities_;
+
         executeBasicBlock(
             state,
             node,
             explorationState->instructionIndex
         );
 
-        // 将状态加入可达状态集合（现在状态的所有权转移到 reachedStates_）
-        reachedStates_.push_back(state);
+        currentExploration_ = nullptr;
+
+        // 搜索策略的收益：新覆盖的边和新报告
+        searchContext_.rewards += (explorationState->newCoverage ? 1 : 0) +
+                                  static_cast<size_t>(foundVulnerabilities_ - reportsBefore);
+        visitedNodes_.insert(node);
+
+        if (governor_) {
+            governor_->chargeState();
+        }
+
+        // 将状态加入可达状态集合（现在状态的所有权转移到 reachedStates_）；
+        // 不保留时后继已各自复制了需要的内容，执行过的状态直接释放。
+        // symbolicState 被置空表示分支把状态原地交给了后继
+        ++reachedCount_;
+        if (config_.retainReachedStates) {
+            reachedStates_.push_back(state);
+        } else if (explorationState->symbolicState == state) {
+            delete state;
+        }
+        if (currentSummary_) {
+            currentSummary_->reachedStates++;
+        }
 
         // 删除探索状态包装器，但不删除 symbolicState
         explorationState->symbolicState = nullptr;
         delete explorationState;
+
+        reportProgress();
+
+        // 目标终止：前沿到不了任何未解决的检查点，继续探索只会重复已有结论；
+        // 剩余状态由调用者丢弃，未用完的预算留给后续函数
+        if (obligations_ && (obligationsChanged_ || iterations % kObligationCheckInterval == 0)) {
+            obligationsChanged_ = false;
+            if (!hasPendingObligations()) {
+                utils::Logger::info("All " + std::to_string(obligations_->size()) +
+                                    " check obligations of " + currentFunction_ +
+                                    " resolved, stopping exploration");
+                ++goalStats_.terminatedFunctions;
+                break;
+            }
+        }
+    }
+
+    // 仍在求解中的状态：可行的回到工作列表，由调用者决定挂起还是丢弃
+    drainParkedStates();
+    if (config_.deterministic) {
+        sortWorklistByPath();
     }
 
-    utils::Logger::info("Explored " + std::to_string(exploredPaths_) + " paths");
+    utils::Logger::info("Explored " + std::to_string(counters_.paths) + " paths");
+
+    return outcome;
+}
+
+SymbolicExecutionEngine::ExploreOutcome SymbolicExecutionEngine::explore() {
+    if (config_.enableFeasibilityCache && !feasibilityCache_) {
+        feasibilityCache_ = std::make_unique<FeasibilityCache>();
+    }
+
+    // 主循环中创建的表达式登记到回收堆；其他分析方式创建的表达式不回收
+    ExprHeap::Scope heapScope(config_.enableExprReclamation ? &exprHeap_ : nullptr);
+
+    // 每种组合是一份独立实例化的主循环，选择只在进入时发生一次
+    auto run = [this](auto solver) {
+        using Solver = decltype(solver);
+        switch (config_.strategy) {
+            case ExplorationStrategy::BFS:
+                return this->template exploreWith<BfsSearcher, Solver>();
+            case ExplorationStrategy::Hybrid:
+                return this->template exploreWith<HybridSearcher, Solver>();
+            case ExplorationStrategy::Random:
+                return this->template exploreWith<RandomSearcher, Solver>();
+            case ExplorationStrategy::Coverage:
+                return this->template exploreWith<CoverageSearcher, Solver>();
+            case ExplorationStrategy::Bandit:
+                return this->template exploreWith<BanditSearcher, Solver>();
+            case ExplorationStrategy::DFS:
+            default:
+                return this->template exploreWith<DfsSearcher, Solver>();
+        }
+    };
+
+    ExploreOutcome outcome = config_.enableFeasibilityCache ? run(CachedSolver{}) : run(DirectSolver{});
+    exprHeap_.reclaim();
+    return outcome;
 }
 
 void SymbolicExecutionEngine::executeBasicBlock(
@@ -200,25 +1022,149 @@ void SymbolicExecutionEngine::executeBasicBlock(
 
     const auto& instructions = bb->getInstructions();
 
-    utils::Logger::debug("Executing " + std::to_string(instructions.size()) + " instructions in block: " + node->getId());
+    utils::Logger::debug("Executing " + std::to_string(instructions.size()) + " instructions in block: " + node->getId());
+
+    // 从块首执行时用转移摘要代替逐条解释非终结指令
+    if (config_.enableTransferCache && startInstIndex == 0 && !instructions.empty()) {
+        if (!transferCache_) {
+            transferCache_ = std::make_unique<BlockTransferCache>();
+        }
+
+        bool known = false;
+        const BlockTransfer* transfer = transferCache_->lookup(bb, known);
+        if (known && transfer) {
+            transferCache_->recordHit();
+        } else if (!known) {
+            transfer = transferCache_->insert(bb, summarizeBlock(bb, node));
+        }
+
+        if (transfer) {
+            applyBlockTransfer(state, bb, *transfer);
+            startInstIndex = static_cast<int>(transfer->effects.size());
+        }
+    }
+
+    // 从指定索引开始执行指令
+    for (size_t i = startInstIndex; i < instructions.size(); ++i) {
+        LLIRInstruction* inst = instructions[i];
+
+        if (!inst) {
+            utils::Logger::warning("Null instruction at index " + std::to_string(i));
+            continue;
+        }
+
+        utils::Logger::debug("Executing instruction at index " + std::to_string(i));
+
+        // 执行指令
+        executeInstruction(state, inst, node, static_cast<int>(i));
+
+        // 检查漏洞
+        checkVulnerabilities(state, inst);
+    }
+}
+
+std::unique_ptr<BlockTransfer> SymbolicExecutionEngine::summarizeBlock(
+    LLIRBasicBlock* bb,
+    CFGNode* node
+) {
+    // 终结指令之前出现分支或返回的块不按摘要执行；调用可能分配或释放堆对象，
+    // 堆效果依赖实际状态，也不做参数化
+    const auto& instructions = bb->getInstructions();
+    size_t prefix = instructions.size();
+    if (isTerminator(instructions.back())) {
+        --prefix;
+    }
+    for (size_t i = 0; i < prefix; ++i) {
+        if (!instructions[i] || isTerminator(instructions[i]) ||
+            instructions[i]->getType() == LLIRInstructionType::Call) {
+            return nullptr;
+        }
+    }
+
+    // 摘要跨函数缓存，其中的表达式不登记到回收堆
+    ExprHeap::Scope untracked(nullptr);
+    auto transfer = std::make_unique<BlockTransfer>();
+    SymbolicState scratch(nullptr);
+    recording_ = transfer.get();
+
+    for (size_t i = 0; i < prefix; ++i) {
+        std::unordered_map<std::string, Expr*> before = scratch.getStore()->getBindings();
+        size_t constraintsBefore = scratch.getPathConstraint()->getConstraints().size();
+
+        transfer->effects.emplace_back();
+        executeInstruction(&scratch, instructions[i], node, static_cast<int>(i));
+
+        // 堆效果依赖实际状态中的对象，不做参数化
+        if (scratch.getHeap()->size() != 0) {
+            recording_ = nullptr;
+            return nullptr;
+        }
+
+        InstructionEffect& effect = transfer->effects.back();
+        for (const auto& [name, expr] : scratch.getStore()->getBindings()) {
+            auto it = before.find(name);
+            if (it != before.end() && it->second == expr) {
+                continue;
+            }
+
+            // 读取活跃输入时建立的绑定在实例化时由 lookupOrBind 重建
+            bool liveInBinding = std::any_of(
+                effect.liveIns.begin(), effect.liveIns.end(),
+                [&](const std::pair<std::string, Expr*>& in) {
+                    return in.first == name && in.second == expr;
+                });
+            if (!liveInBinding) {
+                effect.assignments.emplace_back(name, expr);
+            }
+        }
+        std::sort(effect.assignments.begin(), effect.assignments.end());
+
+        const auto& constraints = scratch.getPathConstraint()->getConstraints();
+        effect.constraints.assign(constraints.begin() + constraintsBefore, constraints.end());
+    }
+
+    recording_ = nullptr;
+    return transfer;
+}
 
-    // 从指定索引开始执行指令
-    for (size_t i = startInstIndex; i < instructions.size(); ++i) {
-        LLIRInstruction* inst = instructions[i];
+void SymbolicExecutionEngine::applyBlockTransfer(
+    SymbolicState* state,
+    LLIRBasicBlock* bb,
+    const BlockTransfer& transfer
+) {
+    // 按解释执行时的顺序分配新鲜符号，实例化结果与逐条执行完全一致
+    TransferSubstitution subst;
+    for (size_t k = 0; k < transfer.numFresh; ++k) {
+        subst.addFreshName(freshVarName());
+    }
 
-        if (!inst) {
-            utils::Logger::warning("Null instruction at index " + std::to_string(i));
-            continue;
+    const auto& instructions = bb->getInstructions();
+    for (size_t i = 0; i < transfer.effects.size(); ++i) {
+        const InstructionEffect& effect = transfer.effects[i];
+        for (const auto& [name, placeholder] : effect.liveIns) {
+            subst.bindLiveIn(placeholder, lookupOrBind(state, name));
+        }
+        for (const auto& [name, expr] : effect.assignments) {
+            state->assign(subst.applyName(name), boundExpression(state, subst.apply(expr)));
+        }
+        for (Expr* constraint : effect.constraints) {
+            state->addConstraint(subst.apply(constraint));
         }
 
-        utils::Logger::debug("Executing instruction at index " + std::to_string(i));
-
-        // 执行指令
-        executeInstruction(state, inst, node, static_cast<int>(i));
+        checkVulnerabilities(state, instructions[i]);
+    }
+}
 
-        // 检查漏洞
-        checkVulnerabilities(state, inst);
+Expr* SymbolicExecutionEngine::lookupOrBind(SymbolicState* state, const std::string& name) {
+    Expr* expr = state->lookup(name);
+    if (!expr) {
+        expr = new VariableExpr(name);
+        state->assign(name, expr);
+        if (recording_) {
+            recording_->effects.back().liveIns.emplace_back(name, expr);
+        }
     }
+    return expr;
 }
 
 void SymbolicExecutionEngine::executeInstruction(
@@ -233,17 +1179,15 @@ void SymbolicExecutionEngine::executeInstruction(
         case LLIRInstructionType::Mul:
         case LLIRInstructionType::Div:
         case LLIRInstructionType::Rem: {
-            // 算术运算：生成新的符号变量
-            std::string varName = freshVarName();
-            auto* result = new VariableExpr(varName);
-            // TODO: 构建完整的符号表达式
+            // 算术运算：结果是以两个操作数为子节点的二元表达式
+            state->assign(resultName(inst), boundExpression(state, executeArithmetic(state, inst)));
             break;
         }
 
         case LLIRInstructionType::ICmp:
         case LLIRInstructionType::FCmp: {
-            // 比较运算
-            executeComparison(state, inst);
+            // 比较运算：结果供后续条件分支使用
+            state->assign(resultName(inst), boundExpression(state, executeComparison(state, inst)));
             break;
         }
 
@@ -263,7 +1207,28 @@ void SymbolicExecutionEngine::executeInstruction(
 
         case LLIRInstructionType::Ret: {
             // 返回指令：路径结束
-            exploredPaths_++;
+            counters_.paths++;
+
+            if (currentSummary_) {
+                currentSummary_->exploredPaths++;
+
+                const auto& constraints = state->getPathConstraint()->getConstraints();
+                std::string post = constraints.empty() ? "true" : "";
+                for (size_t i = 0; i < constraints.size(); ++i) {
+                    post += (i > 0 ? " && " : "") + constraints[i]->toString();
+                }
+                Expr* retVal = inst->getOperands().empty()
+                    ? nullptr : operandToExpr(state, inst->getOperands()[0]);
+                post += " => ret = " + (retVal ? retVal->toString() : std::string("void"));
+                FunctionSummary::addUnique(currentSummary_->postconditions, post);
+
+                for (const HeapObject* obj : state->getHeap()->getUnfreedObjects()) {
+                    std::string effect = "alloc size=" +
+                        (obj->size ? obj->size->toString() : std::string("?")) +
+                        " at " + obj->allocSite.toString();
+                    FunctionSummary::addUnique(currentSummary_->heapEffects, effect);
+                }
+            }
             break;
         }
 
@@ -291,26 +1256,76 @@ Expr* SymbolicExecutionEngine::executeArithmetic(
     SymbolicState* state,
     LLIRInstruction* inst
 ) {
-    // 简化实现：总是返回一个新的符号变量
-    std::string varName = freshVarName();
-    return new VariableExpr(varName);
+    const auto& operands = inst->getOperands();
+    if (operands.size() != 2) {
+        return new VariableExpr(freshVarName());
+    }
+
+    BinaryOpType op;
+    switch (inst->getType()) {
+        case LLIRInstructionType::Add: op = BinaryOpType::Add; break;
+        case LLIRInstructionType::Sub: op = BinaryOpType::Sub; break;
+        case LLIRInstructionType::Mul: op = BinaryOpType::Mul; break;
+        case LLIRInstructionType::Div: op = BinaryOpType::Div; break;
+        case LLIRInstructionType::Rem: op = BinaryOpType::Rem; break;
+        default:
+            return new VariableExpr(freshVarName());
+    }
+
+    return new BinaryOpExpr(op, operandToExpr(state, operands[0]),
+                            operandToExpr(state, operands[1]));
 }
 
 Expr* SymbolicExecutionEngine::executeComparison(
     SymbolicState* state,
     LLIRInstruction* inst
 ) {
-    // 简化实现：总是返回一个新的布尔变量
-    std::string varName = freshVarName() + "_cmp";
-    return new VariableExpr(varName);
+    const auto& operands = inst->getOperands();
+
+    // 没有谓词的比较（以及浮点比较）结果是不透明的布尔变量
+    BinaryOpType op;
+    switch (inst->getType() == LLIRInstructionType::ICmp && operands.size() == 2
+                ? inst->getPredicate() : LLIRCmpPredicate::Unknown) {
+        case LLIRCmpPredicate::EQ: op = BinaryOpType::EQ; break;
+        case LLIRCmpPredicate::NE: op = BinaryOpType::NE; break;
+        case LLIRCmpPredicate::LT: op = BinaryOpType::LT; break;
+        case LLIRCmpPredicate::LE: op = BinaryOpType::LE; break;
+        case LLIRCmpPredicate::GT: op = BinaryOpType::GT; break;
+        case LLIRCmpPredicate::GE: op = BinaryOpType::GE; break;
+        default:
+            return new VariableExpr(freshVarName() + "_cmp");
+    }
+
+    return new BinaryOpExpr(op, operandToExpr(state, operands[0]),
+                            operandToExpr(state, operands[1]));
 }
 
 void SymbolicExecutionEngine::executeMemory(
     SymbolicState* state,
     LLIRInstruction* inst
 ) {
-    // 简化实现：内存操作暂不详细处理
+    // 标量内存模型：每个指针操作数对应一个存储单元，不考虑别名
     // TODO: 实现完整的内存模型
+    const auto& operands = inst->getOperands();
+
+    if (inst->getType() == LLIRInstructionType::Store && operands.size() == 2) {
+        std::string cell = cellName(operands[1]);
+        if (!cell.empty()) {
+            state->assign(cell, operandToExpr(state, operands[0]));
+        }
+    } else if (inst->getType() == LLIRInstructionType::Load && !operands.empty()) {
+        std::string cell = cellName(operands[0]);
+        if (!cell.empty()) {
+            // 未写入过的单元视为自由符号，之后的 load 读到同一个值
+            state->assign(resultName(inst), lookupOrBind(state, cell));
+        }
+    } else if (inst->getType() == LLIRInstructionType::GetElementPtr && operands.size() == 2) {
+        // 地址 = 基址 + 下标。LLIR 的 GEP 不带元素类型，下标与分配大小按同一单位计；
+        // 基址来自堆分配时，检测器据此把指针解析到对象
+        Expr* address = new BinaryOpExpr(BinaryOpType::Add, operandToExpr(state, operands[0]),
+                                         operandToExpr(state, operands[1]));
+        state->assign(resultName(inst), boundExpression(state, address));
+    }
 }
 
 void SymbolicExecutionEngine::executeBranch(
@@ -319,7 +1334,6 @@ void SymbolicExecutionEngine::executeBranch(
     CFGNode* currentNode,
     int instIndex
 ) {
-    // 简化实现：无条件分支，直接跳转到后继节点
     const auto& successors = currentNode->getSuccessors();
 
     if (successors.empty()) {
@@ -327,33 +1341,220 @@ void SymbolicExecutionEngine::executeBranch(
         return;
     }
 
-    for (auto* succ : successors) {
-        // 克隆状态
-        auto cloned = state->clone();
-        auto* newState = cloned.release();
+    Expr* guards[2] = {nullptr, nullptr};
+    branchGuards(state, inst, successors.size(), guards);
+
+    // 分支条件已经求出：离开当前块后不再读取的绑定不必复制到后继状态。
+    // 块中间的分支之后还有指令在当前状态上执行，不做删除
+    bool dropDead = liveness_ &&
+        static_cast<size_t>(instIndex) + 1 == currentNode->getBasicBlock()->getInstructions().size();
+    if (dropDead) {
+        counters_.deadBindings += state->getStore()->removeIf([&](const std::string& name) {
+            return !liveness_->isLiveOut(currentNode, name);
+        });
+    }
+
+    // 惰性分叉：先判定各后继的可行性，确定不可行的后继不复制状态。
+    // 只在路径剪枝开启时判定，当前状态此时已确认可行
+    bool decided[2] = {false, false};
+    bool feasible[2] = {true, true};
+    if (config_.enableLazyFork && config_.enablePathPruning) {
+        for (size_t i = 0; i < 2; ++i) {
+            if (guards[i]) {
+                decided[i] = precheckGuard(state, guards[i], guards[1 - i], feasible[i]);
+            }
+        }
+    }
+
+    // 块末的分支之后当前状态不再使用：最后一个可行的后继直接沿用它
+    size_t inPlace = successors.size();
+    if (config_.enableLazyFork && !config_.retainReachedStates && currentExploration_ &&
+        currentExploration_->symbolicState == state &&
+        static_cast<size_t>(instIndex) + 1 == currentNode->getBasicBlock()->getInstructions().size()) {
+        for (size_t i = successors.size(); i-- > 0;) {
+            if (i < 2 && !feasible[i]) {
+                continue;
+            }
+            // 进入可加速循环的后继由闭式摘要另建状态，不沿用
+            const AcceleratedLoop* loop = loopAccelerator_ ? loopAccelerator_->getLoop(successors[i]) : nullptr;
+            if (!loop || loop->contains(currentNode)) {
+                inPlace = i;
+            }
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < successors.size(); ++i) {
+        CFGNode* succ = successors[i];
+
+        if (i < 2 && !feasible[i]) {
+            utils::Logger::debug("Successor " + succ->getId() + " infeasible, not forking");
+            counters_.lazyPrunedForks++;
+            counters_.infeasiblePaths++;
+            continue;
+        }
+
+        // 克隆状态（子路径继承父路径的全部约束）
+        SymbolicState* newState = state;
+        if (i == inPlace) {
+            currentExploration_->symbolicState = nullptr;
+            counters_.inPlaceForks++;
+        } else {
+            newState = forkState(state);
+        }
 
         if (!newState) {
             utils::Logger::error("Failed to clone symbolic state");
             continue;
         }
 
+        // 只在其他后继上活跃的绑定
+        if (dropDead && successors.size() > 1) {
+            counters_.deadBindings += newState->getStore()->removeIf([&](const std::string& name) {
+                return !liveness_->isLiveIn(succ, name);
+            });
+        }
+
+        Expr* guard = i < 2 ? guards[i] : nullptr;
+        if (guard) {
+            newState->addConstraint(guard);
+        }
+
+        // 只有多后继分支延长路径前缀
+        std::vector<uint32_t> pathId;
+        if (currentExploration_) {
+            pathId = currentExploration_->pathId;
+        }
+        if (successors.size() > 1) {
+            pathId.push_back(static_cast<uint32_t>(i));
+        }
+
+        // 从循环外进入可加速的循环：用闭式摘要代替逐次展开
+        const AcceleratedLoop* loop = loopAccelerator_ ? loopAccelerator_->getLoop(succ) : nullptr;
+        if (loop && !loop->contains(currentNode)) {
+            if (currentCoverage_) {
+                currentCoverage_->visit(currentNode, succ);
+            }
+            ExplorationState* exitExploration = accelerateLoop(newState, *loop);
+            delete newState;
+            exitExploration->pathId = std::move(pathId);
+            worklist_.push_back(exitExploration);
+            continue;
+        }
+
         // 创建新的探索状态
         auto* newExplorationState = new ExplorationState(newState, succ);
         newExplorationState->instructionIndex = 0;
+        newExplorationState->usage = currentPathUsage();
+        newExplorationState->usage.memoryBytes = newState->estimateMemoryUsage();
+        newExplorationState->needsFeasibilityCheck = guard != nullptr;
+        if (guard && decided[i]) {
+            newExplorationState->needsFeasibilityCheck = false;
+            counters_.lazyDecidedForks++;
+        }
+        newExplorationState->pathId = std::move(pathId);
+        newExplorationState->previousNode = currentNode;
 
         // 加入工作列表
-        worklist_.push(newExplorationState);
+        worklist_.push_back(newExplorationState);
 
         utils::Logger::debug("Added new exploration state for node: " + succ->getId());
     }
 }
 
+void SymbolicExecutionEngine::branchGuards(
+    SymbolicState* state,
+    LLIRInstruction* inst,
+    size_t numSuccessors,
+    Expr* guards[2]
+) {
+    // 条件分支（条件、then、else）：为两个后继分别生成分支约束
+    if (inst->getOperands().size() == 3 && numSuccessors == 2) {
+        Expr* cond = operandToExpr(state, inst->getOperands()[0]);
+        if (cond) {
+            if (isBooleanExpr(cond)) {
+                guards[0] = cond;
+                guards[1] = new UnaryOpExpr(UnaryOpType::LNot, cond);
+            } else {
+                guards[0] = new BinaryOpExpr(BinaryOpType::NE, cond, new ConstantExpr(0));
+                guards[1] = new BinaryOpExpr(BinaryOpType::EQ, cond, new ConstantExpr(0));
+            }
+        }
+    }
+}
+
+bool SymbolicExecutionEngine::precheckGuard(
+    const SymbolicState* state,
+    Expr* guard,
+    Expr* complement,
+    bool& feasible
+) {
+    int truth = guardTruth(guard);
+    if (truth >= 0) {
+        feasible = truth == 1;
+        return true;
+    }
+
+    // 同一条件（按结构哈希，再比较文本防止碰撞）已在路径上
+    std::string guardText, complementText;
+    for (const Expr* constraint : state->getPathConstraint()->getConstraints()) {
+        if (constraint->hash() == guard->hash()) {
+            if (guardText.empty()) {
+                guardText = guard->toString();
+            }
+            if (constraint->toString() == guardText) {
+                feasible = true;
+                return true;
+            }
+        }
+        if (complement && constraint->hash() == complement->hash()) {
+            if (complementText.empty()) {
+                complementText = complement->toString();
+            }
+            if (constraint->toString() == complementText) {
+                feasible = false;
+                return true;
+            }
+        }
+    }
+
+    if (feasibilityCache_) {
+        PathConstraint extended = *state->getPathConstraint();
+        extended.add(guard);
+        return feasibilityCache_->lookup(extended, feasible);
+    }
+    return false;
+}
+
 void SymbolicExecutionEngine::executeCall(
     SymbolicState* state,
     LLIRInstruction* inst
 ) {
-    // 简化实现：函数调用暂不处理
-    // TODO: 实现函数调用和返回
+    // 第一个操作数是被调函数名，其余是实参
+    const auto& operands = inst->getOperands();
+    auto* callee = operands.empty() ? nullptr : dynamic_cast<LLIRVariable*>(operands[0]);
+    if (!callee) {
+        return;
+    }
+
+    const std::string& name = callee->getName();
+    SymbolicHeap* heap = state->getHeap();
+    if ((name == "malloc" && operands.size() == 2) || (name == "calloc" && operands.size() == 3)) {
+        // 分配总是成功：结果是新对象的基址
+        Expr* size = operandToExpr(state, operands[1]);
+        if (name == "calloc") {
+            auto* count = dynamic_cast<ConstantExpr*>(size);
+            Expr* elemSize = operandToExpr(state, operands[2]);
+            auto* constElemSize = dynamic_cast<ConstantExpr*>(elemSize);
+            size = count && constElemSize
+                ? static_cast<Expr*>(new ConstantExpr(count->getValue() * constElemSize->getValue()))
+                : new BinaryOpExpr(BinaryOpType::Mul, size, elemSize);
+        }
+        state->assign(resultName(inst), heap->allocate(size, inst->getLocation()));
+    } else if (name == "free" && operands.size() == 2) {
+        heap->free(operandToExpr(state, operands[1]));
+    }
+    // 其他函数调用暂不处理：结果在读取时视为自由符号
 }
 
 void SymbolicExecutionEngine::checkVulnerabilities(
@@ -363,26 +1564,28 @@ void SymbolicExecutionEngine::checkVulnerabilities(
     // TODO: 集成各个漏洞检测器
     // 这里简化实现，仅作演示
 
+    VulnerabilityReport* report = nullptr;
+
     // 检查是否有load指令（可能的空指针解引用）
     if (inst->getType() == LLIRInstructionType::Load) {
         // 创建检测器
         NullPointerChecker checker;
-        auto* report = checker.check(state, inst);
-        if (report) {
-            foundVulnerabilities_++;
-            utils::Logger::error("Vulnerability found: " + report->toString());
-            delete report;
-        }
+        report = checker.check(state, inst);
     }
 
-    // 检查是否有store指令（可能的缓冲区溢出）
+    // 检查是否有store指令（可能的缓冲区溢出）；目标指针只查找不绑定，
+    // 检查不改变状态
     if (inst->getType() == LLIRInstructionType::Store) {
         BufferOverflowChecker checker;
-        auto* report = checker.check(state, inst);
-        if (report) {
-            foundVulnerabilities_++;
-            utils::Logger::error("Vulnerability found: " + report->toString());
-            delete report;
+        const auto& operands = inst->getOperands();
+        Expr* pointer = operands.size() == 2 ? state->lookup(valueName(operands[1])) : nullptr;
+        report = checker.check(state, inst, pointer);
+    }
+
+    if (report) {
+        recordReport(state, report);
+        if (obligations_ && obligations_->resolve(inst)) {
+            obligationsChanged_ = true;
         }
     }
 }
@@ -408,30 +1611,491 @@ bool SymbolicExecutionEngine::shouldPrunePath(SymbolicState* state) {
         return false;
     }
 
-    // 简化实现：检查路径约束是否可满足
-    // 实际实现中需要调用SMT求解器
-    // 目前总是返回 false（不剪枝）
-    return false;
+    if (pathConstraint->getConstraints().empty()) {
+        return false;
+    }
+
+    return !pathConstraint->isSatisfiable();
+}
+
+void SymbolicExecutionEngine::nameInstructionResults(LLIRFunction* func) {
+    // 按 "%<基本块>.<指令序号>" 命名，跨运行保持稳定
+    for (auto* bb : func->getBasicBlocks()) {
+        const auto& instructions = bb->getInstructions();
+        for (size_t i = 0; i < instructions.size(); ++i) {
+            resultNames_[instructions[i]] = "%" + bb->getName() + "." + std::to_string(i);
+        }
+    }
+}
+
+std::string SymbolicExecutionEngine::resultName(const LLIRInstruction* inst) const {
+    auto it = resultNames_.find(inst);
+    if (it != resultNames_.end()) {
+        return it->second;
+    }
+    return "%" + std::to_string(reinterpret_cast<uintptr_t>(inst));
+}
+
+Expr* SymbolicExecutionEngine::operandToExpr(SymbolicState* state, LLIRValue* value) {
+    if (!value) {
+        return nullptr;
+    }
+
+    if (auto* constant = dynamic_cast<LLIRConstant*>(value)) {
+        if (constant->isInteger()) {
+            return new ConstantExpr(constant->getIntValue());
+        }
+        if (constant->isNull()) {
+            return new ConstantExpr(0);
+        }
+        return new VariableExpr(freshVarName());
+    }
+
+    std::string name = valueName(value);
+    if (name.empty()) {
+        return new VariableExpr(freshVarName());
+    }
+
+    // 未绑定的值（参数、未执行过的指令结果）视为自由符号
+    return lookupOrBind(state, name);
+}
+
+std::string SymbolicExecutionEngine::valueName(LLIRValue* value) const {
+    if (auto* inst = dynamic_cast<LLIRInstruction*>(value)) {
+        return resultName(inst);
+    }
+    if (auto* var = dynamic_cast<LLIRVariable*>(value)) {
+        return var->getName();
+    }
+    if (auto* arg = dynamic_cast<LLIRArgument*>(value)) {
+        return arg->getName();
+    }
+    if (auto* global = dynamic_cast<LLIRGlobalVariable*>(value)) {
+        return global->getName();
+    }
+    return "";
+}
+
+std::string SymbolicExecutionEngine::cellName(LLIRValue* ptr) const {
+    std::string name = valueName(ptr);
+    return name.empty() ? "" : "*" + name;
+}
+
+SymbolicState* SymbolicExecutionEngine::forkState(SymbolicState* state) const {
+    auto* forked = state->clone().release();
+    if (forked) {
+        // 整体复制约束向量，只分配一次
+        *forked->getPathConstraint() = *state->getPathConstraint();
+    }
+    return forked;
+}
+
+Expr* SymbolicExecutionEngine::evaluateLoopCondition(
+    SymbolicState* state,
+    const AcceleratedLoop& loop,
+    bool check
+) {
+    const auto& insts = loop.header->getBasicBlock()->getInstructions();
+    for (size_t i = 0; i + 1 < insts.size(); ++i) {
+        executeInstruction(state, insts[i], loop.header, static_cast<int>(i));
+        if (check) {
+            checkVulnerabilities(state, insts[i]);
+        }
+    }
+
+    Expr* cond = operandToExpr(state, loop.branch->getOperands()[0]);
+    return loop.continueOnTrue ? cond : new UnaryOpExpr(UnaryOpType::LNot, cond);
+}
+
+ExplorationState* SymbolicExecutionEngine::accelerateLoop(
+    SymbolicState* entryState,
+    const AcceleratedLoop& loop
+) {
+    const std::string prefix = loop.header->getId() + ".";
+
+    // 迭代次数 N，以及任意一次迭代的序号 k
+    auto* tripCount = new VariableExpr(prefix + "trip." + freshVarName());
+    auto* iteration = new VariableExpr(prefix + "iter." + freshVarName());
+    auto* zero = new ConstantExpr(0);
+
+    // 归纳变量的初值：进入循环时的单元值（未写入过的单元先绑定为自由符号）
+    std::vector<std::pair<std::string, Expr*>> inductionCells;
+    for (const auto& iv : loop.inductionVariables) {
+        std::string cell = cellName(iv.slot);
+        Expr* initial = entryState->lookup(cell);
+        if (!initial) {
+            initial = new VariableExpr(cell);
+            entryState->assign(cell, initial);
+        }
+        inductionCells.emplace_back(cell, initial);
+    }
+
+    // 第 n 次迭代开始时：iv = init + step * n；其他被写入的单元取任意值
+    auto setIteration = [&](SymbolicState* state, Expr* n) {
+        for (size_t i = 0; i < inductionCells.size(); ++i) {
+            Expr* delta = new BinaryOpExpr(BinaryOpType::Mul,
+                new ConstantExpr(loop.inductionVariables[i].step), n);
+            state->assign(inductionCells[i].first,
+                new BinaryOpExpr(BinaryOpType::Add, inductionCells[i].second, delta));
+        }
+        for (auto* slot : loop.clobbered) {
+            std::string cell = cellName(slot);
+            if (!cell.empty()) {
+                state->assign(cell, new VariableExpr(cell + "." + freshVarName()));
+            }
+        }
+    };
+
+    // 迭代次数约束：条件在第 0..N-1 次迭代时成立，在第 N 次时不成立。
+    // 继续条件随迭代单调，所以只需检查第 N-1 次和第 N 次
+    SymbolicState* scratch = forkState(entryState);
+    setIteration(scratch, new BinaryOpExpr(BinaryOpType::Sub, tripCount, new ConstantExpr(1)));
+    Expr* continueBeforeLast = evaluateLoopCondition(scratch, loop, false);
+    delete scratch;
+
+    std::vector<Expr*> tripConstraints = {
+        new BinaryOpExpr(BinaryOpType::GE, tripCount, zero),
+        new BinaryOpExpr(BinaryOpType::LOr,
+            new BinaryOpExpr(BinaryOpType::EQ, tripCount, zero), continueBeforeLast)
+    };
+
+    // 出口状态：所有单元取第 N 次迭代开始时的值，循环头最后一次求值失败
+    SymbolicState* exitState = forkState(entryState);
+    setIteration(exitState, tripCount);
+    Expr* continueAtExit = evaluateLoopCondition(exitState, loop, false);
+    for (Expr* constraint : tripConstraints) {
+        exitState->addConstraint(constraint);
+    }
+    exitState->addConstraint(new UnaryOpExpr(UnaryOpType::LNot, continueAtExit));
+
+    // 检查状态：0 <= k <= N 时执行循环头，k < N 时执行循环体。
+    // 循环中的每个检查只做一次，覆盖所有迭代
+    SymbolicState* iterState = forkState(entryState);
+    for (Expr* constraint : tripConstraints) {
+        iterState->addConstraint(constraint);
+    }
+    iterState->addConstraint(new BinaryOpExpr(BinaryOpType::GE, iteration, zero));
+    iterState->addConstraint(new BinaryOpExpr(BinaryOpType::LE, iteration, tripCount));
+    setIteration(iterState, iteration);
+    Expr* continueAtIteration = evaluateLoopCondition(iterState, loop, true);
+    iterState->addConstraint(new BinaryOpExpr(BinaryOpType::LT, iteration, tripCount));
+    iterState->addConstraint(continueAtIteration);
+
+    // 循环体可能一次都不执行（N 恒为 0 等）：与主循环一样先确认检查状态可行，
+    // 不可行时不检查循环体，也不计入覆盖
+    bool bodyFeasible = true;
+    if (config_.enablePathPruning) {
+        bool cached = feasibilityCache_ &&
+                      feasibilityCache_->lookup(*iterState->getPathConstraint(), bodyFeasible);
+        if (!cached) {
+            utils::Timer solverTimer;
+            bodyFeasible = !shouldPrunePath(iterState);
+            if (feasibilityCache_) {
+                feasibilityCache_->insert(*iterState->getPathConstraint(), bodyFeasible);
+            }
+            double solverMs = solverTimer.elapsedMs();
+            if (currentExploration_) {
+                currentExploration_->usage.solverMs += solverMs;
+            }
+            if (governor_) {
+                governor_->chargeSolverTime(solverMs);
+            }
+        }
+    }
+
+    if (bodyFeasible) {
+        for (size_t n = 1; n < loop.nodes.size(); ++n) {
+            CFGNode* node = loop.nodes[n];
+            const auto& insts = node->getBasicBlock()->getInstructions();
+            for (size_t i = 0; i + 1 < insts.size(); ++i) {
+                executeInstruction(iterState, insts[i], node, static_cast<int>(i));
+                checkVulnerabilities(iterState, insts[i]);
+            }
+            visitedNodes_.insert(node);
+        }
+    }
+    visitedNodes_.insert(loop.header);
+    delete iterState;
+
+    counters_.acceleratedLoops++;
+    utils::Logger::debug("Accelerated loop at " + loop.header->getId() +
+                         " with trip count " + tripCount->toString() +
+                         (bodyFeasible ? "" : " (body unreachable)"));
+
+    // 闭式摘要覆盖了循环中的所有边
+    if (currentCoverage_ && bodyFeasible) {
+        for (size_t i = 0; i < loop.nodes.size(); ++i) {
+            currentCoverage_->visit(loop.nodes[i], loop.nodes[(i + 1) % loop.nodes.size()]);
+        }
+    }
 
-    // TODO: 启用路径剪枝（需要修复 Z3Solver 问题）
-    // return !pathConstraint->isSatisfiable();
+    auto* exitExploration = new ExplorationState(exitState, loop.exit);
+    exitExploration->previousNode = loop.header;
+    exitExploration->usage = currentPathUsage();
+    exitExploration->usage.memoryBytes = exitState->estimateMemoryUsage();
+    exitExploration->needsFeasibilityCheck = true;
+    return exitExploration;
 }
 
 std::string SymbolicExecutionEngine::freshVarName() {
+    if (recording_) {
+        return BlockTransferCache::freshPlaceholder(recording_->numFresh++);
+    }
     return "v" + std::to_string(varCounter_++);
 }
 
+Expr* SymbolicExecutionEngine::boundExpression(SymbolicState* state, Expr* expr) {
+    // 生成转移摘要时的表达式以占位符为叶子，实例化后再调控
+    if (!expr || recording_) {
+        return expr;
+    }
+    bool oversized = config_.maxExprSize > 0 &&
+                     expr->getSize() > static_cast<uint32_t>(config_.maxExprSize);
+    bool tooDeep = config_.maxExprDepth > 0 &&
+                   expr->getDepth() > static_cast<uint32_t>(config_.maxExprDepth);
+    if (!oversized && !tooDeep) {
+        return expr;
+    }
+
+    if (config_.exprBudgetPolicy == ExprBudgetPolicy::Concretize) {
+        if (Expr* value = concretizeExpression(state, expr)) {
+            ++counters_.concretizedExprs;
+            return value;
+        }
+    }
+    ++counters_.abstractedExprs;
+    return abstractExpression(state, expr);
+}
+
+Expr* SymbolicExecutionEngine::concretizeExpression(SymbolicState* state, Expr* expr) {
+    if (!concretizeSolver_) {
+        concretizeSolver_ = std::make_unique<Z3Solver>();
+        if (config_.deterministic) {
+            concretizeSolver_->setTimeout(std::numeric_limits<unsigned int>::max());
+            concretizeSolver_->setResourceLimit(kDeterministicSolverRlimit);
+        } else if (config_.timeoutPerPath > 0) {
+            concretizeSolver_->setTimeout(static_cast<unsigned int>(config_.timeoutPerPath) * 1000u);
+        }
+    }
+
+    // 用一个只出现在查询中的符号取出 expr 的值，布尔表达式按 0/1 取值
+    const std::string probe = "%concretize";
+    bool boolean = isBooleanExpr(expr);
+    Expr* term = boolean ? new IteExpr(expr, new ConstantExpr(1), new ConstantExpr(0)) : expr;
+    PathConstraint query = *state->getPathConstraint();
+    query.add(new BinaryOpExpr(BinaryOpType::EQ, new VariableExpr(probe), term));
+    if (concretizeSolver_->check(&query) != SolverResult::Sat) {
+        return nullptr;
+    }
+    CounterExample model = concretizeSolver_->getModel();
+    auto it = model.intValues.find(probe);
+    if (it == model.intValues.end()) {
+        return nullptr;
+    }
+
+    // 路径从此只覆盖取这个值的输入
+    int64_t value = it->second;
+    if (boolean) {
+        state->addConstraint(value != 0 ? expr : new UnaryOpExpr(UnaryOpType::LNot, expr));
+        return new ConstantExpr(value != 0 ? 1 : 0);
+    }
+    state->addConstraint(new BinaryOpExpr(BinaryOpType::EQ, expr, new ConstantExpr(value)));
+    return new ConstantExpr(value);
+}
+
+Expr* SymbolicExecutionEngine::abstractExpression(SymbolicState* state, Expr* expr) {
+    // 与 freshVarName() 分开编号，不影响转移摘要中新鲜符号的分配顺序
+    auto* symbol = new VariableExpr("%abs" + std::to_string(counters_.abstractedExprs));
+    int64_t lo = 0;
+    int64_t hi = 0;
+    if (isBooleanExpr(expr)) {
+        lo = 0;
+        hi = 1;
+    } else if (!exprInterval(expr, lo, hi)) {
+        return symbol;
+    }
+    if (lo > std::numeric_limits<int64_t>::min()) {
+        state->addConstraint(new BinaryOpExpr(BinaryOpType::GE, symbol, new ConstantExpr(lo)));
+    }
+    if (hi < std::numeric_limits<int64_t>::max()) {
+        state->addConstraint(new BinaryOpExpr(BinaryOpType::LE, symbol, new ConstantExpr(hi)));
+    }
+    return symbol;
+}
+
 std::string SymbolicExecutionEngine::getStatistics() const {
     std::ostringstream oss;
 
     oss << "Symbolic Execution Statistics:\n";
-    oss << "  Explored Paths: " << exploredPaths_ << "\n";
-    oss << "  Reached States: " << reachedStates_.size() << "\n";
+    oss << "  Explored Paths: " << counters_.paths << "\n";
+    oss << "  Reached States: " << reachedCount_ + forkStats_.states << "\n";
     oss << "  Found Vulnerabilities: " << foundVulnerabilities_ << "\n";
+    oss << "  Budget-Pruned Paths: " << counters_.prunedPaths << "\n";
+    oss << "  Infeasible Paths: " << counters_.infeasiblePaths << "\n";
+    oss << "  Accelerated Loops: " << counters_.acceleratedLoops << "\n";
+    if (config_.enableStateDeduplication) {
+        oss << "  Duplicate States: " << counters_.duplicateStates << "\n";
+    }
+    if (config_.enableDeadBindingElimination) {
+        oss << "  Dead Bindings Dropped: " << counters_.deadBindings << "\n";
+    }
+    if (counters_.concretizedExprs + counters_.abstractedExprs > 0) {
+        oss << "  Concretized Expressions: " << counters_.concretizedExprs << "\n";
+        oss << "  Abstracted Expressions: " << counters_.abstractedExprs << "\n";
+    }
+    if (config_.enableLazyFork) {
+        oss << "  Lazy Fork: " << counters_.lazyPrunedForks << " infeasible not cloned, "
+            << counters_.lazyDecidedForks << " feasible without solving, "
+            << counters_.inPlaceForks << " reused in place\n";
+    }
+    if (config_.enableExprReclamation) {
+        oss << "  Reclaimed Expressions: " << exprHeap_.getNumFreed() << " in "
+            << exprHeap_.getNumCollections() << " collections ("
+            << exprHeap_.getNumTracked() << " live, "
+            << exprHeap_.getNumRetired() << " awaiting solver)\n";
+    }
+    if (config_.deterministic) {
+        oss << "  Deterministic Mode: on\n";
+    }
 
     double elapsed = startTimer_.elapsedSec();
     oss << "  Elapsed Time: " << std::fixed << elapsed << "s\n";
 
+    auto poolStatistics = [&oss](const char* name, const PoolStatistics& pool) {
+        oss << "  " << name << ": " << pool.allocations << " allocated, "
+            << pool.reuses << " reused, " << pool.live << " live, "
+            << pool.slabs << " slabs (" << utils::FormatUtils::formatBytes(pool.slabBytes) << ")\n";
+    };
+    // 对象池是进程级的，统计包括同一进程中的其他引擎实例
+    oss << "State Pool Statistics:\n";
+    poolStatistics("Exploration States", ObjectPool<ExplorationState>::getStatistics());
+    poolStatistics("Symbolic States", ObjectPool<SymbolicState>::getStatistics());
+
+    if (governor_) {
+        oss << governor_->getStatistics();
+    }
+
+    if (solverPipeline_) {
+        oss << solverPipeline_->getStatistics();
+    }
+
+    size_t edges = 0, coveredEdges = 0, blocks = 0, coveredBlocks = 0;
+    for (const auto& [name, coverage] : coverage_) {
+        edges += coverage->getNumEdges();
+        coveredEdges += coverage->getNumCoveredEdges();
+        blocks += coverage->getNumBlocks();
+        coveredBlocks += coverage->getNumCoveredBlocks();
+    }
+    if (edges > 0) {
+        auto percent = [](size_t covered, size_t total) {
+            return total > 0 ? 100.0 * covered / total : 0.0;
+        };
+        oss << "Coverage Statistics:\n";
+        oss << std::setprecision(1)
+            << "  Edges: " << coveredEdges << " / " << edges
+            << " (" << percent(coveredEdges, edges) << "%)\n"
+            << "  Blocks: " << coveredBlocks << " / " << blocks
+            << " (" << percent(coveredBlocks, blocks) << "%)\n";
+    }
+
+    if (forkStats_.subtrees > 0) {
+        oss << forkStats_.getStatistics();
+    }
+
+    if (summaryStore_) {
+        oss << summaryStore_->getStatistics();
+    }
+
+    if (transferCache_) {
+        oss << transferCache_->getStatistics();
+    }
+
+    if (feasibilityCache_) {
+        oss << feasibilityCache_->getStatistics();
+    }
+
+    if (config_.strategy == ExplorationStrategy::Bandit) {
+        oss << BanditSearcher::getStatistics(searchContext_);
+    }
+
+    if (config_.bmcBound > 0) {
+        oss << bmcStats_.getStatistics(config_.bmcBound);
+    }
+
+    if (config_.kInduction > 0) {
+        oss << inductionStats_.getStatistics(config_.kInduction);
+    }
+
+    if (config_.enableLazyAbstraction) {
+        oss << lazyStats_.getStatistics();
+    }
+
+    if (config_.enableHybridFuzzing) {
+        oss << fuzzStats_.getStatistics(NativeExecutor::isSupported() ? "native" : "interpreter");
+    }
+
+    if (config_.enableGoalTermination) {
+        oss << goalStats_.getStatistics();
+    }
+
+    return oss.str();
+}
+
+// ============================================================================
+// ExplorationProgress 实现
+// ============================================================================
+
+std::string ExplorationProgress::toJson(
+    const std::string& taskId,
+    size_t filesAnalyzed,
+    size_t totalFiles
+) const {
+    // 总体进度：已完成函数 + 当前函数的覆盖率
+    int percent = 100;
+    if (!finished && totalFunctions > 0) {
+        double done = functionsCompleted + std::min(coverage, 1.0);
+        percent = static_cast<int>(100.0 * done / totalFunctions);
+        percent = std::min(percent, 99);
+    }
+
+    std::time_t now = std::time(nullptr);
+    std::tm utc{};
+#if defined(_WIN32)
+    gmtime_s(&utc, &now);
+#else
+    gmtime_r(&now, &utc);
+#endif
+
+    std::string message;
+    if (cancelled) {
+        message = "Analysis cancelled";
+    } else if (finished) {
+        message = "Analysis finished";
+    } else {
+        message = "Analyzing function " + function + "...";
+    }
+
+    std::ostringstream oss;
+    oss << "{\"type\":\"progress\""
+        << ",\"taskId\":" << utils::StringUtils::jsonString(taskId)
+        << ",\"timestamp\":\"" << std::put_time(&utc, "%Y-%m-%dT%H:%M:%SZ") << "\""
+        << ",\"data\":{"
+        << "\"progress\":" << percent
+        << ",\"message\":" << utils::StringUtils::jsonString(message)
+        << ",\"filesAnalyzed\":" << filesAnalyzed
+        << ",\"totalFiles\":" << totalFiles
+        << ",\"engine\":{"
+        << "\"function\":" << utils::StringUtils::jsonString(function)
+        << ",\"functionsCompleted\":" << functionsCompleted
+        << ",\"totalFunctions\":" << totalFunctions
+        << ",\"statesPerSec\":" << std::fixed << std::setprecision(1) << statesPerSec
+        << ",\"frontierSize\":" << frontierSize
+        << ",\"coverage\":" << std::setprecision(3) << coverage
+        << ",\"exploredPaths\":" << exploredPaths
+        << ",\"reachedStates\":" << reachedStates
+        << ",\"reportsFound\":" << reportsFound
+        << "}}}";
+
     return oss.str();
 }
 
@@ -460,14 +2124,65 @@ VulnerabilityReport* BufferOverflowChecker::check(
     return report;
 }
 
+VulnerabilityReport* BufferOverflowChecker::check(
+    SymbolicState* state,
+    LLIRInstruction* inst,
+    Expr* pointer
+) {
+    if (inst->getType() != LLIRInstructionType::Store) {
+        return nullptr;
+    }
+
+    const SymbolicHeap* heap = state->getHeap();
+    int64_t constant = 0;
+    bool symbolic = false;
+    const HeapObject* object = pointer ? heap->decompose(pointer, constant, symbolic) : nullptr;
+    if (!object || !object->size) {
+        return check(state, inst);
+    }
+
+    if (!symbolic && dynamic_cast<ConstantExpr*>(object->size)) {
+        // 常量地址：对象区域就是 [base, base + size)，落在本对象内即在界内
+        std::vector<const HeapObject*> hits = heap->resolve(pointer);
+        if (hits.size() == 1 && hits.front() == object) {
+            return nullptr;
+        }
+    } else if (isSafeAccess(pointer, object->address, object->size, state)) {
+        return nullptr;
+    }
+
+    auto* report = new VulnerabilityReport();
+    report->type = VulnerabilityType::BufferOverflow;
+    report->severity = Severity::High;
+    report->location = inst->getLocation();
+    report->message = "Heap buffer overflow detected";
+    report->description = "Store through " + pointer->toString() + " may write outside the " +
+                          object->size->toString() + "-unit object allocated at " +
+                          object->allocSite.toString();
+
+    return report;
+}
+
 bool BufferOverflowChecker::isSafeAccess(
     Expr* ptr,
     Expr* buffer,
     Expr* size,
     SymbolicState* state
 ) {
-    // 简化实现：总是返回true（假设安全）
-    // 实际实现中需要使用SMT求解器验证
+    // 偏移 = 指针 - 基址；在当前路径约束下偏移不可能 < 0 且不可能 >= size 才安全。
+    // 没有求解器时 isSatisfiable 保守地返回可满足，即报告
+    Expr* offset = new BinaryOpExpr(BinaryOpType::Sub, ptr, buffer);
+    Expr* violations[] = {
+        new BinaryOpExpr(BinaryOpType::LT, offset, new ConstantExpr(0)),
+        new BinaryOpExpr(BinaryOpType::GE, offset, size),
+    };
+    for (Expr* violation : violations) {
+        PathConstraint query = *state->getPathConstraint();
+        query.add(violation);
+        if (query.isSatisfiable()) {
+            return false;
+        }
+    }
     return true;
 }
 
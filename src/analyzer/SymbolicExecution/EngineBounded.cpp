@@ -0,0 +1,408 @@
+/**
+ * @file EngineBounded.cpp
+ * @brief 符号执行引擎：有界模型检查与 k 归纳
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/Utils.h"
+#include "cverifier/Z3Solver.h"
+#include <algorithm>
+#include <sstream>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 有界模型检查
+// ============================================================================
+
+std::unique_ptr<UnrolledEncoding> SymbolicExecutionEngine::encodeUnrolled(const UnrolledCFG& unrolled) {
+    const auto& blocks = unrolled.getBlocks();
+    auto encoding = std::make_unique<UnrolledEncoding>();
+    encoding->blocks.resize(blocks.size());
+
+    auto toInteger = [](Expr* value) -> Expr* {
+        return isBooleanExpr(value)
+            ? new IteExpr(value, new ConstantExpr(1), new ConstantExpr(0)) : value;
+    };
+    auto conjoin = [](Expr* a, Expr* b) -> Expr* {
+        return !a ? b : !b ? a : new BinaryOpExpr(BinaryOpType::LAnd, a, b);
+    };
+
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        if (isStopped()) {
+            return nullptr;
+        }
+
+        const UnrolledBlock& block = blocks[b];
+        EncodedBlock& result = encoding->blocks[b];
+        result.state = std::make_unique<SymbolicState>(nullptr);
+
+        // 到达条件：某条入边被走过
+        std::vector<Expr*> edgeConds;
+        bool always = false;
+        for (const auto& [pred, succIndex] : block.predecessors) {
+            const EncodedBlock& predResult = encoding->blocks[pred];
+            Expr* cond = conjoin(predResult.guard, predResult.edgeGuards[succIndex]);
+            always = always || !cond;
+            edgeConds.push_back(cond);
+        }
+        const auto& [firstPred, firstSucc] = block.predecessors.empty()
+            ? std::pair<size_t, size_t>(0, 0) : block.predecessors[0];
+        if (block.predecessors.size() == 1 && !encoding->blocks[firstPred].edgeGuards[firstSucc]) {
+            result.guardVar = encoding->blocks[firstPred].guardVar;
+            result.guard = encoding->blocks[firstPred].guard;
+        } else if (!always && !edgeConds.empty()) {
+            Expr* any = edgeConds[0];
+            for (size_t i = 1; i < edgeConds.size(); ++i) {
+                any = new BinaryOpExpr(BinaryOpType::LOr, any, edgeConds[i]);
+            }
+            result.guardVar = encoding->define("bmc.g", any);
+            result.guard = new BinaryOpExpr(BinaryOpType::EQ, result.guardVar, new ConstantExpr(1));
+        }
+
+        // 入口存储：前驱的值相同时直接沿用，不同时用 phi（ite 链）合并。
+        // 经过回边的复合值也换成新名字，避免表达式随展开次数增长。
+        // 起点的存储为空，所有值都是自由符号
+        std::set<std::string> names;
+        for (const auto& [pred, succIndex] : block.predecessors) {
+            for (const auto& [name, expr] : encoding->blocks[pred].state->getStore()->getBindings()) {
+                names.insert(name);
+            }
+        }
+        bool backEdge = !block.predecessors.empty() &&
+                        blocks[block.predecessors[0].first].layer < block.layer;
+        for (const auto& name : names) {
+            std::vector<Expr*> values;
+            bool same = true;
+            for (const auto& [pred, succIndex] : block.predecessors) {
+                Expr* value = encoding->blocks[pred].state->lookup(name);
+                if (!value) {
+                    value = new VariableExpr(name);
+                }
+                if (!values.empty() && value != values[0] &&
+                    (value->getType() != values[0]->getType() ||
+                     (value->getType() != ExprType::Constant && value->getType() != ExprType::Variable) ||
+                     value->toString() != values[0]->toString())) {
+                    same = false;
+                }
+                values.push_back(value);
+            }
+
+            Expr* value = values[0];
+            if (!same) {
+                Expr* phi = toInteger(values.back());
+                for (size_t i = values.size() - 1; i-- > 0;) {
+                    phi = edgeConds[i] ? new IteExpr(edgeConds[i], toInteger(values[i]), phi)
+                                       : toInteger(values[i]);
+                }
+                value = encoding->define(name, phi);
+            } else if (backEdge && value->getType() != ExprType::Constant &&
+                       value->getType() != ExprType::Variable) {
+                value = encoding->define(name, value);
+            }
+            result.state->assign(name, value);
+        }
+
+        if (result.guard) {
+            result.state->addConstraint(result.guard);
+        }
+        size_t constraintsBefore = result.state->getPathConstraint()->getConstraints().size();
+
+        // 终结指令只决定出边的分支约束
+        LLIRInstruction* terminator = nullptr;
+        const auto& instructions = block.node->getBasicBlock()->getInstructions();
+        for (size_t i = 0; i < instructions.size(); ++i) {
+            LLIRInstruction* inst = instructions[i];
+            if (!inst) {
+                continue;
+            }
+            if (isTerminator(inst)) {
+                terminator = inst;
+                continue;
+            }
+
+            executeInstruction(result.state.get(), inst, block.node, static_cast<int>(i));
+            if (ObligationTracker::isCheckSite(inst)) {
+                auto& instances = encoding->siteBlocks[inst];
+                if (instances.empty()) {
+                    encoding->sites.push_back(inst);
+                }
+                instances.push_back(b);
+            }
+        }
+
+        // 指令附加的约束只在到达该实例时成立
+        const auto& constraints = result.state->getPathConstraint()->getConstraints();
+        for (size_t i = constraintsBefore; i < constraints.size(); ++i) {
+            encoding->definitions.push_back(result.guard
+                ? new BinaryOpExpr(BinaryOpType::LOr,
+                                   new UnaryOpExpr(UnaryOpType::LNot, result.guard), constraints[i])
+                : constraints[i]);
+        }
+
+        size_t numSuccessors = block.node->getSuccessors().size();
+        result.edgeGuards.assign(numSuccessors, nullptr);
+        if (terminator && terminator->getType() == LLIRInstructionType::Br) {
+            Expr* guards[2] = {nullptr, nullptr};
+            branchGuards(result.state.get(), terminator, numSuccessors, guards);
+            for (size_t i = 0; i < numSuccessors && i < 2; ++i) {
+                result.edgeGuards[i] = guards[i];
+            }
+        }
+    }
+
+    bmcStats_.blocks += blocks.size();
+    return encoding;
+}
+
+SymbolicExecutionEngine::ExploreOutcome SymbolicExecutionEngine::exploreBounded() {
+    UnrolledCFG unrolled(currentCFG_, config_.bmcBound);
+    bmcStats_.truncated += unrolled.getNumTruncated();
+
+    utils::Logger::info("Bounded model checking with bound " + std::to_string(config_.bmcBound) +
+                        ": " + std::to_string(unrolled.getBlocks().size()) + " unrolled blocks");
+
+    std::unique_ptr<UnrolledEncoding> encoding = encodeUnrolled(unrolled);
+    if (!encoding) {
+        return ExploreOutcome::Aborted;
+    }
+    const auto& sites = encoding->sites;
+
+    // 检查点可达当且仅当它的某个实例可达；必然可达的检查点不需要求解
+    std::vector<VariableExpr*> siteVars(sites.size(), nullptr);
+    std::vector<bool> reported(sites.size(), false);
+    auto report = [&](size_t site, const CounterExample* model) {
+        const auto& instances = encoding->siteBlocks[sites[site]];
+        size_t instance = instances.front();
+        for (size_t b : instances) {
+            const VariableExpr* guardVar = encoding->blocks[b].guardVar;
+            if (!guardVar) {
+                instance = b;
+                break;
+            }
+            if (model) {
+                auto it = model->intValues.find(guardVar->getName());
+                if (it != model->intValues.end() && it->second == 1) {
+                    instance = b;
+                    break;
+                }
+            }
+        }
+        checkVulnerabilities(encoding->blocks[instance].state.get(), sites[site]);
+        reported[site] = true;
+    };
+
+    for (size_t s = 0; s < sites.size(); ++s) {
+        if (Expr* any = encoding->anyReached(encoding->siteBlocks[sites[s]])) {
+            siteVars[s] = encoding->define("bmc.site", any);
+        } else {
+            report(s, nullptr);
+        }
+    }
+    const auto& definitions = encoding->definitions;
+    bmcStats_.definitions += definitions.size();
+
+    // 每次查询求出一组同时可达的检查点，报告后排除，直到剩余的都不可达
+    Z3Solver solver;
+    if (config_.deterministic) {
+        solver.setTimeout(std::numeric_limits<unsigned int>::max());
+        solver.setResourceLimit(kDeterministicSolverRlimit);
+    } else if (config_.timeout > 0) {
+        solver.setTimeout(static_cast<unsigned int>(config_.timeout) * 1000u);
+    }
+
+    ExploreOutcome outcome = ExploreOutcome::Completed;
+    while (true) {
+        std::vector<size_t> remaining;
+        for (size_t s = 0; s < sites.size(); ++s) {
+            if (!reported[s]) {
+                remaining.push_back(s);
+            }
+        }
+        if (remaining.empty()) {
+            break;
+        }
+
+        PathConstraint query;
+        for (Expr* definition : definitions) {
+            query.add(definition);
+        }
+        Expr* anySite = nullptr;
+        for (size_t s : remaining) {
+            Expr* reached = new BinaryOpExpr(BinaryOpType::EQ, siteVars[s], new ConstantExpr(1));
+            anySite = anySite ? new BinaryOpExpr(BinaryOpType::LOr, anySite, reached) : reached;
+        }
+        query.add(anySite);
+
+        ++bmcStats_.queries;
+        SolverResult result = solver.check(&query);
+        if (isStopped()) {
+            outcome = ExploreOutcome::Aborted;
+            break;
+        }
+        if (result == SolverResult::Unsat) {
+            break;
+        }
+
+        std::vector<size_t> found;
+        CounterExample model = solver.getModel();
+        if (result == SolverResult::Sat) {
+            for (size_t s : remaining) {
+                auto it = model.intValues.find(siteVars[s]->getName());
+                if (it != model.intValues.end() && it->second == 1) {
+                    found.push_back(s);
+                }
+            }
+        }
+
+        // 求解失败或没有模型（未启用 Z3）时与路径探索一样按可达处理
+        if (found.empty()) {
+            found = remaining;
+        }
+        for (size_t s : found) {
+            report(s, result == SolverResult::Sat ? &model : nullptr);
+        }
+    }
+
+    utils::Logger::info("Bounded model checking finished: " + std::to_string(sites.size()) +
+                        " check sites, " + std::to_string(definitions.size()) + " definitions");
+    return outcome;
+}
+
+// ============================================================================
+// k 归纳
+// ============================================================================
+
+void SymbolicExecutionEngine::proveSafeSites() {
+    const int k = config_.kInduction;
+
+    std::vector<LLIRInstruction*> candidates;
+    for (auto* bb : currentCFG_->getFunction()->getBasicBlocks()) {
+        for (auto* inst : bb->getInstructions()) {
+            if (ObligationTracker::isCheckSite(inst)) {
+                candidates.push_back(inst);
+            }
+        }
+    }
+    if (candidates.empty()) {
+        return;
+    }
+    inductionStats_.candidates += candidates.size();
+
+    // 归纳步从每个循环头（回边目标）开始，状态全部是自由符号
+    std::unordered_set<const CFGNode*> headerSet;
+    for (const auto& [source, header] : currentCFG_->findBackEdges()) {
+        headerSet.insert(header);
+    }
+    std::vector<std::unique_ptr<UnrolledCFG>> stepGraphs;
+    std::vector<std::unique_ptr<UnrolledEncoding>> steps;
+    for (auto* bb : currentCFG_->getFunction()->getBasicBlocks()) {
+        CFGNode* node = currentCFG_->getNode(bb->getName());
+        if (node && headerSet.count(node)) {
+            stepGraphs.push_back(std::make_unique<UnrolledCFG>(currentCFG_, k, node));
+            steps.push_back(encodeUnrolled(*stepGraphs.back()));
+            if (!steps.back()) {
+                return;
+            }
+        }
+    }
+
+    UnrolledCFG baseGraph(currentCFG_, k);
+    std::unique_ptr<UnrolledEncoding> base = encodeUnrolled(baseGraph);
+    if (!base) {
+        return;
+    }
+
+    if (!proofPipeline_) {
+        size_t workers = static_cast<size_t>(std::max(config_.solverThreads, 2));
+        proofPipeline_ = config_.deterministic
+            ? std::make_unique<SolverPipeline>(workers, &cancelToken_,
+                  std::numeric_limits<unsigned int>::max(), kDeterministicSolverRlimit)
+            : std::make_unique<SolverPipeline>(workers, &cancelToken_);
+    }
+
+    // 每个检查点一个基础情形查询，每个循环头一个归纳步查询，任何一个可满足
+    // （或没有结论）都不能证明
+    std::vector<bool> refuted(candidates.size(), false);
+    std::unordered_map<SolverTicket, size_t> pending;
+    auto submit = [&](const UnrolledEncoding& encoding, Expr* goal, size_t site) {
+        std::vector<Expr*> query(encoding.definitions);
+        query.push_back(goal);
+        pending[proofPipeline_->submit(std::move(query))] = site;
+        ++inductionStats_.queries;
+    };
+
+    for (size_t c = 0; c < candidates.size() && !refuted[c]; ++c) {
+        auto baseIt = base->siteBlocks.find(candidates[c]);
+        if (baseIt != base->siteBlocks.end()) {
+            Expr* reached = base->anyReached(baseIt->second);
+            if (!reached) {
+                refuted[c] = true;
+                continue;
+            }
+            submit(*base, reached, c);
+        }
+
+        for (size_t h = 0; h < steps.size(); ++h) {
+            auto stepIt = steps[h]->siteBlocks.find(candidates[c]);
+            if (stepIt == steps[h]->siteBlocks.end()) {
+                continue;
+            }
+
+            std::vector<size_t> last, earlier;
+            for (size_t b : stepIt->second) {
+                (stepGraphs[h]->getBlocks()[b].layer == k ? last : earlier).push_back(b);
+            }
+            if (last.empty()) {
+                continue;
+            }
+
+            // 之前的层中必然已经到达时不构成反例
+            Expr* reachedEarlier = earlier.empty() ? nullptr : steps[h]->anyReached(earlier);
+            if (!earlier.empty() && !reachedEarlier) {
+                continue;
+            }
+            Expr* goal = steps[h]->anyReached(last);
+            if (reachedEarlier) {
+                Expr* notEarlier = new UnaryOpExpr(UnaryOpType::LNot, reachedEarlier);
+                goal = goal ? new BinaryOpExpr(BinaryOpType::LAnd, goal, notEarlier) : notEarlier;
+            }
+            if (!goal) {
+                refuted[c] = true;
+                break;
+            }
+            submit(*steps[h], goal, c);
+        }
+    }
+
+    SolverCompletion completion;
+    while (!pending.empty() && proofPipeline_->waitCollect(completion)) {
+        auto it = pending.find(completion.ticket);
+        if (it == pending.end()) {
+            continue;
+        }
+        if (completion.result != SolverResult::Unsat) {
+            refuted[it->second] = true;
+        }
+        pending.erase(it);
+    }
+    if (isStopped()) {
+        return;
+    }
+
+    for (size_t c = 0; c < candidates.size(); ++c) {
+        if (refuted[c]) {
+            continue;
+        }
+        ++inductionStats_.proven;
+        utils::Logger::debug("Check site at " + candidates[c]->getLocation().toString() +
+                             " proven unreachable by " + std::to_string(k) + "-induction");
+        if (obligations_ && obligations_->discharge(candidates[c])) {
+            obligationsChanged_ = true;
+        }
+    }
+}
+
+} // namespace core
+} // namespace cverifier
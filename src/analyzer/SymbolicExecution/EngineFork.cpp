@@ -0,0 +1,228 @@
+/**
+ * @file EngineFork.cpp
+ * @brief 符号执行引擎：fork 模式（子树交给子进程探索）
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/ExprCodec.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+#include <sstream>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+/// fork 模式下每个子进程平均分到的子树数：子树大小差异大，多拆分一些便于负载均衡
+constexpr size_t kForkSubtreesPerWorker = 2;
+
+} // anonymous namespace
+
+// ============================================================================
+// fork 模式
+// ============================================================================
+
+SymbolicExecutionEngine::ExploreOutcome SymbolicExecutionEngine::exploreForked() {
+    // 先在父进程中探索，直到前沿宽到足以分给所有子进程
+    splitFrontier_ = static_cast<size_t>(config_.forkWorkers) * kForkSubtreesPerWorker;
+    ExploreOutcome outcome = explore();
+    splitFrontier_ = 0;
+
+    if (outcome != ExploreOutcome::FrontierSplit) {
+        return outcome;
+    }
+
+    // fork() 时不能有其他线程：先收回仍在求解中的状态（可行的回到前沿，一起
+    // 分给子进程），再停止求解线程池，子进程中同步求解
+    drainParkedStates();
+    solverPipeline_.reset();
+    proofPipeline_.reset();
+
+    // 子树按路径前缀编号，与前沿形成的先后无关
+    sortWorklistByPath();
+    std::vector<ExplorationState*> subtrees;
+    while (!worklist_.empty()) {
+        subtrees.push_back(worklist_.front());
+        worklist_.pop_front();
+    }
+
+    utils::Logger::info("Forking " + std::to_string(subtrees.size()) + " subtrees of " +
+                        currentFunction_ + " onto " + std::to_string(config_.forkWorkers) +
+                        " worker processes");
+
+    // 剩余状态预算在子树之间平分
+    size_t baseStates = reachedCount_;
+    size_t maxStates = static_cast<size_t>(std::max(config_.maxStates, 0));
+    size_t statesPerSubtree = std::max<size_t>(
+        (maxStates > baseStates ? maxStates - baseStates : 0) / subtrees.size(), 1);
+
+    auto childTask = [&](size_t index, int fd) -> int {
+        forkChannel_ = fd;
+        progressCallback_ = nullptr;
+        // 父进程的挂起状态已在分叉前收回；子进程只探索分给它的子树
+        parked_.clear();
+        config_.solverThreads = 0;
+        config_.maxStates = static_cast<int>(baseStates + statesPerSubtree);
+
+        ExplorationCounters baseCounters = counters_;
+
+        worklist_.push_back(subtrees[index]);
+        ExploreOutcome childOutcome = explore();
+
+        ForkSubtreeStats stats;
+        stats.counters = counters_ - baseCounters;
+        stats.states = reachedCount_ - baseStates;
+        // 路径预算丢弃过路径的子树不算完整探索
+        stats.complete = childOutcome == ExploreOutcome::Completed && stats.counters.prunedPaths == 0;
+        ForkExplorer::writeRecord(fd, "stats " + stats.encode());
+
+        if (currentCoverage_) {
+            std::ostringstream covered;
+            covered << "coverage";
+            for (size_t edge : currentCoverage_->getCoveredEdges()) {
+                covered << " " << edge;
+            }
+            ForkExplorer::writeRecord(fd, covered.str());
+        }
+
+        if (obligations_) {
+            std::ostringstream resolved;
+            resolved << "obligations";
+            for (size_t index : obligations_->getReportedIndices()) {
+                resolved << " " << index;
+            }
+            ForkExplorer::writeRecord(fd, resolved.str());
+        }
+
+        if (currentSummary_) {
+            for (const auto& pre : currentSummary_->preconditions) {
+                ForkExplorer::writeRecord(fd, "pre " + FunctionSummary::escapeField(pre));
+            }
+            for (const auto& post : currentSummary_->postconditions) {
+                ForkExplorer::writeRecord(fd, "post " + FunctionSummary::escapeField(post));
+            }
+            for (const auto& heap : currentSummary_->heapEffects) {
+                ForkExplorer::writeRecord(fd, "heap " + FunctionSummary::escapeField(heap));
+            }
+        }
+        return 0;
+    };
+
+    // 确定性模式：记录先按子树缓存，全部结束后按子树序号合并，
+    // 报告顺序与子进程完成的先后无关
+    std::vector<char> completed(subtrees.size(), 0);
+    std::vector<std::vector<std::string>> buffered(subtrees.size());
+    auto onRecord = [&](size_t index, const std::string& record) {
+        if (config_.deterministic) {
+            buffered[index].push_back(record);
+            return;
+        }
+        bool subtreeCompleted = completed[index] != 0;
+        mergeForkRecord(record, subtreeCompleted);
+        completed[index] = subtreeCompleted;
+    };
+
+    ForkLimits limits;
+    limits.memoryLimitMB = static_cast<size_t>(std::max(config_.forkMemoryLimitMB, 0));
+    limits.cpuSeconds = config_.deterministic ? 0 : config_.timeout;
+
+    ForkExplorer explorer(limits, &cancelToken_);
+    auto outcomes = explorer.run(subtrees.size(), static_cast<size_t>(config_.forkWorkers),
+                                 childTask, onRecord);
+
+    if (config_.deterministic) {
+        for (size_t i = 0; i < buffered.size(); ++i) {
+            bool subtreeCompleted = false;
+            for (const auto& record : buffered[i]) {
+                mergeForkRecord(record, subtreeCompleted);
+            }
+            completed[i] = subtreeCompleted;
+        }
+    }
+
+    // 子树由子进程探索，父进程中的副本不再需要
+    for (auto* subtree : subtrees) {
+        delete subtree->symbolicState;
+        delete subtree;
+    }
+
+    forkStats_.subtrees += static_cast<int>(outcomes.size());
+    outcome = ExploreOutcome::Completed;
+    for (size_t i = 0; i < outcomes.size(); ++i) {
+        if (!outcomes[i].finished) {
+            // 崩溃/内存耗尽的子树：已发回的报告保留，函数不算完整探索
+            forkStats_.failed++;
+            outcome = ExploreOutcome::Aborted;
+        } else if (!completed[i] && outcome == ExploreOutcome::Completed) {
+            outcome = ExploreOutcome::BudgetExhausted;
+        }
+    }
+
+    return outcome;
+}
+
+void SymbolicExecutionEngine::mergeForkRecord(const std::string& record, bool& completed) {
+    size_t space = record.find(' ');
+    std::string tag = record.substr(0, space);
+    std::string value = space == std::string::npos ? "" : record.substr(space + 1);
+
+    if (tag == "report") {
+        VulnerabilityReport report;
+        if (!FunctionSummary::decodeReport(value, report)) {
+            utils::Logger::warning("Ignoring malformed report from fork subtree");
+            return;
+        }
+        foundVulnerabilities_++;
+        if (currentSummary_) {
+            currentSummary_->reports.push_back(report);
+        }
+        reports_.push_back(std::move(report));
+    } else if (tag == "stats") {
+        ForkSubtreeStats stats;
+        if (!ForkSubtreeStats::decode(value, stats)) {
+            utils::Logger::warning("Ignoring malformed statistics from fork subtree");
+            return;
+        }
+        counters_ += stats.counters;
+        forkStats_.states += stats.states;
+        completed = stats.complete;
+
+        if (currentSummary_) {
+            currentSummary_->exploredPaths += stats.counters.paths;
+            currentSummary_->reachedStates += stats.states;
+        }
+    } else if (tag == "coverage") {
+        std::istringstream iss(value);
+        size_t edge = 0;
+        while (currentCoverage_ && iss >> edge) {
+            currentCoverage_->markEdge(edge);
+        }
+    } else if (tag == "obligations") {
+        // 子树中报告过的检查点：父进程和子进程的跟踪器编号一致
+        std::istringstream iss(value);
+        size_t index = 0;
+        while (obligations_ && iss >> index) {
+            obligations_->resolveIndex(index);
+        }
+    } else if (currentSummary_ && tag == "constraints") {
+        ExprArena arena;
+        ExprDecoder decoder(arena);
+        std::vector<Expr*> constraints;
+        if (!decoder.decode(FunctionSummary::unescapeField(value), constraints)) {
+            utils::Logger::warning("Ignoring malformed path constraints from fork subtree: " +
+                                   decoder.getLastError());
+            return;
+        }
+        FunctionSummary::addUnique(currentSummary_->preconditions, conjunctionString(constraints));
+    } else if (currentSummary_ && tag == "pre") {
+        FunctionSummary::addUnique(currentSummary_->preconditions, FunctionSummary::unescapeField(value));
+    } else if (currentSummary_ && tag == "post") {
+        FunctionSummary::addUnique(currentSummary_->postconditions, FunctionSummary::unescapeField(value));
+    } else if (currentSummary_ && tag == "heap") {
+        FunctionSummary::addUnique(currentSummary_->heapEffects, FunctionSummary::unescapeField(value));
+    }
+}
+
+} // namespace core
+} // namespace cverifier
@@ -0,0 +1,206 @@
+/**
+ * @file EngineHybrid.cpp
+ * @brief 符号执行引擎：混合模糊测试
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/Utils.h"
+#include "cverifier/Z3Solver.h"
+#include <algorithm>
+#include <sstream>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 混合模糊测试
+// ============================================================================
+
+SymbolicExecutionEngine::ExploreOutcome SymbolicExecutionEngine::exploreHybrid() {
+    const size_t maxExecutions = static_cast<size_t>(std::max(config_.maxStates, 1));
+    const size_t plateau = static_cast<size_t>(std::max(config_.fuzzPlateau, 1));
+
+    // 单次具体执行的分支数与符号探索的深度上限相同，重放的路径不会更长
+    if (config_.deterministic) {
+        utils::Random::seed(static_cast<uint32_t>(utils::HashUtils::fnv1a(currentFunction_)));
+    }
+    HybridFuzzer fuzzer(module_, currentFunction_, static_cast<size_t>(std::max(config_.maxDepth, 1)));
+
+    Z3Solver solver;
+    if (config_.deterministic) {
+        solver.setTimeout(std::numeric_limits<unsigned int>::max());
+        solver.setResourceLimit(kDeterministicSolverRlimit);
+    } else if (config_.timeoutPerPath > 0) {
+        solver.setTimeout(static_cast<unsigned int>(config_.timeoutPerPath) * 1000u);
+    }
+
+    ExploreOutcome outcome = ExploreOutcome::Completed;
+    size_t solverSeeds = 0;
+    size_t replayed = 0;
+    fuzzer.execute({});
+
+    while (true) {
+        if (isStopped()) {
+            outcome = ExploreOutcome::Aborted;
+            break;
+        }
+
+        // 带来新覆盖的输入沿同一路径符号重放，做漏洞检查
+        for (; replayed < fuzzer.getCorpus().size(); ++replayed) {
+            replayConcrete(fuzzer.getCorpus()[replayed].result, std::numeric_limits<size_t>::max(), nullptr);
+        }
+        reportProgress();
+
+        if (fuzzer.getExecutions() >= maxExecutions) {
+            outcome = ExploreOutcome::BudgetExhausted;
+            break;
+        }
+        if (fuzzer.getExecutionsSinceProgress() < plateau) {
+            fuzzer.fuzzOne();
+            continue;
+        }
+
+        // 覆盖停滞：翻转经过未覆盖走向的种子在该分支处的约束，求出越过它的输入。
+        // 种子的其他输入保持不变，求解器只决定路径约束涉及的值
+        ++fuzzStats_.handoffs;
+        bool progress = false;
+        for (const FrontierBranch& target : fuzzer.takeFrontier()) {
+            if (isStopped() || fuzzer.getExecutions() >= maxExecutions) {
+                break;
+            }
+            FuzzSeed seed = fuzzer.getCorpus()[target.seed];
+            std::unordered_map<std::string, std::string> aliases;
+            std::unique_ptr<SymbolicState> state = replayConcrete(seed.result, target.event, &aliases);
+            if (!state) {
+                continue;
+            }
+
+            ++fuzzStats_.queries;
+            if (solver.check(state->getPathConstraint()) != SolverResult::Sat) {
+                continue;
+            }
+            CounterExample model = solver.getModel();
+            auto inputName = [&aliases](const std::string& name) {
+                auto it = aliases.find(name);
+                return it != aliases.end() ? it->second : name;
+            };
+            for (const auto& [name, value] : model.intValues) {
+                seed.inputs[inputName(name)] = value;
+            }
+            for (const auto& [name, value] : model.boolValues) {
+                seed.inputs[inputName(name)] = value ? 1 : 0;
+            }
+
+            if (fuzzer.execute(seed.inputs, true)) {
+                ++solverSeeds;
+                progress = true;
+            }
+        }
+
+        // 求解也越不过剩余的前沿：覆盖已收敛
+        if (!progress) {
+            for (; replayed < fuzzer.getCorpus().size(); ++replayed) {
+                replayConcrete(fuzzer.getCorpus()[replayed].result, std::numeric_limits<size_t>::max(), nullptr);
+            }
+            break;
+        }
+    }
+
+    fuzzStats_.executions += fuzzer.getExecutions();
+    fuzzStats_.corpus += fuzzer.getCorpus().size();
+    fuzzStats_.outcomes += fuzzer.getNumCoveredOutcomes();
+    fuzzStats_.solvedSeeds += solverSeeds;
+
+    utils::Logger::info("Hybrid fuzzing finished: " + std::to_string(fuzzer.getExecutions()) +
+                        " executions (" + (fuzzer.usesNativeBackend() ? "native" : "interpreted") + "), " +
+                        std::to_string(fuzzer.getCorpus().size()) + " seeds, " +
+                        std::to_string(solverSeeds) + " from the solver");
+    return outcome;
+}
+
+std::unique_ptr<SymbolicState> SymbolicExecutionEngine::replayConcrete(
+    const ConcreteResult& run,
+    size_t flip,
+    std::unordered_map<std::string, std::string>* aliases
+) {
+    const bool check = flip >= run.branches.size();
+    const size_t maxSteps = static_cast<size_t>(std::max(config_.maxDepth, 1)) + 1;
+    auto state = std::make_unique<SymbolicState>(nullptr);
+
+    CFGNode* previous = nullptr;
+    CFGNode* node = currentCFG_->getEntryNode();
+    size_t event = 0;
+    for (size_t steps = 0; node && steps < maxSteps; ++steps) {
+        if (check) {
+            visitedNodes_.insert(node);
+            if (currentCoverage_) {
+                currentCoverage_->visit(previous, node);
+            }
+        }
+
+        const auto& instructions = node->getBasicBlock()->getInstructions();
+        LLIRInstruction* terminator = nullptr;
+        for (size_t k = 0; k < instructions.size(); ++k) {
+            LLIRInstruction* inst = instructions[k];
+            if (!inst) {
+                continue;
+            }
+            if (isTerminator(inst)) {
+                terminator = inst;
+                break;
+            }
+            executeInstruction(state.get(), inst, node, static_cast<int>(k));
+            if (check) {
+                checkVulnerabilities(state.get(), inst);
+            }
+
+            // 引擎为不计算的结果（无谓词比较等）生成新符号，具体执行按结果名取输入
+            Expr* value = aliases ? state->lookup(resultName(inst)) : nullptr;
+            if (value && value->getType() == ExprType::Variable &&
+                static_cast<VariableExpr*>(value)->getName() != resultName(inst)) {
+                (*aliases)[static_cast<VariableExpr*>(value)->getName()] = resultName(inst);
+            }
+        }
+
+        const auto& successors = node->getSuccessors();
+        previous = node;
+        if (terminator && terminator->getType() == LLIRInstructionType::Ret) {
+            if (check) {
+                executeInstruction(state.get(), terminator, node, 0);
+            }
+            break;
+        }
+        if (!terminator || terminator->getOperands().size() != 3 || successors.size() != 2) {
+            // 两侧目标相同的条件分支在 CFG 中只有一个后继，但具体执行仍记录了走向
+            if (terminator && event < run.branches.size() && run.branches[event].branch == terminator) {
+                ++event;
+            }
+            node = successors.empty() ? nullptr : successors[0];
+            continue;
+        }
+
+        // 条件分支：走具体执行记录的一侧（截断的执行在记录结束处停止）
+        if (event >= run.branches.size() || run.branches[event].branch != terminator) {
+            break;
+        }
+        size_t succIndex = run.branches[event].successor;
+        if (event == flip) {
+            succIndex = 1 - succIndex;
+        }
+        Expr* guards[2] = {nullptr, nullptr};
+        branchGuards(state.get(), terminator, successors.size(), guards);
+        if (guards[succIndex]) {
+            state->addConstraint(guards[succIndex]);
+        }
+        if (event == flip) {
+            return state;
+        }
+        ++event;
+        node = successors[succIndex];
+    }
+
+    return check ? std::move(state) : nullptr;
+}
+
+} // namespace core
+} // namespace cverifier
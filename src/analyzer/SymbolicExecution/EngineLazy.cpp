@@ -0,0 +1,356 @@
+/**
+ * @file EngineLazy.cpp
+ * @brief 符号执行引擎：惰性抽象（抽象可达树）
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/Utils.h"
+#include "cverifier/Z3Solver.h"
+#include <algorithm>
+#include <set>
+#include <sstream>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+/// 惰性抽象细化时每个节点最多尝试的候选插值数
+constexpr size_t kMaxInterpolantCandidates = 12;
+
+/**
+ * @brief 后缀条件中比较原子派生的候选插值（按出现顺序去重）
+ *
+ * 相等原子先拆成两个严格不等，再是原子的否定和原子本身
+ */
+std::vector<Expr*> interpolantCandidates(Expr* suffix) {
+    std::vector<Expr*> atoms;
+    std::set<std::string> seen;
+    std::vector<Expr*> pending{suffix};
+    while (!pending.empty()) {
+        Expr* expr = pending.back();
+        pending.pop_back();
+        if (expr->getType() == ExprType::UnaryOp &&
+            static_cast<UnaryOpExpr*>(expr)->getOp() == UnaryOpType::LNot) {
+            pending.push_back(static_cast<UnaryOpExpr*>(expr)->getOperand());
+        } else if (expr->getType() == ExprType::BinaryOp) {
+            auto* binary = static_cast<BinaryOpExpr*>(expr);
+            if (binary->getOp() == BinaryOpType::LAnd || binary->getOp() == BinaryOpType::LOr) {
+                pending.push_back(binary->getRight());
+                pending.push_back(binary->getLeft());
+            } else if (isBooleanExpr(binary) && seen.insert(binary->toString()).second) {
+                atoms.push_back(binary);
+            }
+        }
+    }
+
+    std::vector<Expr*> candidates;
+    for (Expr* atom : atoms) {
+        auto* binary = static_cast<BinaryOpExpr*>(atom);
+        if (binary->getOp() == BinaryOpType::EQ) {
+            candidates.push_back(new BinaryOpExpr(BinaryOpType::GT, binary->getLeft(), binary->getRight()));
+            candidates.push_back(new BinaryOpExpr(BinaryOpType::LT, binary->getLeft(), binary->getRight()));
+        }
+        candidates.push_back(new UnaryOpExpr(UnaryOpType::LNot, atom));
+        candidates.push_back(atom);
+        if (candidates.size() >= kMaxInterpolantCandidates) {
+            candidates.resize(kMaxInterpolantCandidates);
+            break;
+        }
+    }
+    return candidates;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// 惰性抽象
+// ============================================================================
+
+SymbolicExecutionEngine::ExploreOutcome SymbolicExecutionEngine::exploreLazy() {
+    AbstractReachabilityTree art(currentCFG_->getEntryNode());
+    const size_t maxNodes = static_cast<size_t>(std::max(config_.maxStates, 1));
+
+    Z3Solver solver;
+    if (config_.deterministic) {
+        solver.setTimeout(std::numeric_limits<unsigned int>::max());
+        solver.setResourceLimit(kDeterministicSolverRlimit);
+    } else if (config_.timeout > 0) {
+        solver.setTimeout(static_cast<unsigned int>(config_.timeout) * 1000u);
+    }
+
+    auto conjoin = [](Expr* a, Expr* b) -> Expr* {
+        return !a ? b : !b ? a : new BinaryOpExpr(BinaryOpType::LAnd, a, b);
+    };
+    // 没有结论时按可满足处理：只会少覆盖、少细化
+    auto unsat = [&](Expr* expr) {
+        ++lazyStats_.queries;
+        return solver.check(expr) == SolverResult::Unsat;
+    };
+    auto implies = [&](Expr* label, Expr* other) {
+        return !other || unsat(conjoin(label, new UnaryOpExpr(UnaryOpType::LNot, other)));
+    };
+    auto isDead = [](const ArtNode* node) {
+        for (; node; node = node->parent) {
+            if (node->refuted) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::vector<ArtNode*> worklist{art.getRoot()};
+    std::vector<ArtNode*> uncovered;
+
+    // 同一位置上更早的节点标签更弱时，它的子树代表了这里的所有状态
+    auto close = [&](ArtNode* node) {
+        for (ArtNode* other : art.nodesAt(node->location)) {
+            if (other->id >= node->id) {
+                break;
+            }
+            if (!art.isCovered(other) && !isDead(other) && implies(node->label, other->label)) {
+                art.cover(node, other, uncovered);
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // 不可行的错误路径：为每个节点求一个插值，合取到标签上
+    auto refine = [&](const std::vector<ArtNode*>& path, size_t siteEnd) {
+        ++lazyStats_.refinements;
+        std::vector<ArtStep> steps = encodePathSteps(path, siteEnd);
+
+        // 后缀可达条件（在节点位置的变量当前值上），它的否定是最弱的插值
+        std::vector<Expr*> suffixes(path.size(), nullptr);
+        Expr* suffix = nullptr;
+        for (size_t i = path.size(); i-- > 0;) {
+            suffix = conjoin(steps[i].condition, substituteVariables(suffix, steps[i].bindings));
+            suffixes[i] = suffix;
+        }
+
+        std::vector<ArtNode*> strengthened;
+        Expr* previous = nullptr;
+        for (size_t i = 0; i < path.size(); ++i) {
+            ArtNode* node = path[i];
+            if (!suffixes[i]) {
+                // 后缀必然可达，不可行的是到这里为止的前缀
+                node->refuted = true;
+                art.uncoverBy(node, uncovered);
+                break;
+            }
+
+            // 优先用后缀中的单个原子（相等拆成两个严格不等）：它们更容易在
+            // 循环的各次迭代之间保持，使标签收敛。候选要被上一个插值经过这一步
+            // 转移蕴含，并与后缀矛盾，否则退回最弱插值
+            Expr* interpolant = new UnaryOpExpr(UnaryOpType::LNot, suffixes[i]);
+            for (Expr* candidate : interpolantCandidates(suffixes[i])) {
+                Expr* entailed = i == 0
+                    ? candidate : substituteVariables(candidate, steps[i - 1].bindings);
+                Expr* violation = new UnaryOpExpr(UnaryOpType::LNot, entailed);
+                if (i > 0) {
+                    violation = conjoin(conjoin(previous, steps[i - 1].condition), violation);
+                }
+                if (unsat(violation) && unsat(conjoin(candidate, suffixes[i]))) {
+                    interpolant = candidate;
+                    break;
+                }
+            }
+            previous = interpolant;
+
+            if (implies(node->label, interpolant)) {
+                continue;
+            }
+            node->label = conjoin(node->label, interpolant);
+            art.uncoverBy(node, uncovered);
+            strengthened.push_back(node);
+            if (unsat(node->label)) {
+                node->refuted = true;
+                break;
+            }
+        }
+
+        // 标签变化后，路径上的节点可能已被更早的节点覆盖
+        for (ArtNode* node : strengthened) {
+            if (!node->refuted && !art.isCovered(node) && close(node)) {
+                break;
+            }
+        }
+    };
+
+    std::unordered_set<const LLIRInstruction*> resolved;
+    ExploreOutcome outcome = ExploreOutcome::Completed;
+
+    while (!worklist.empty() || !uncovered.empty()) {
+        worklist.insert(worklist.end(), uncovered.rbegin(), uncovered.rend());
+        uncovered.clear();
+        if (isStopped()) {
+            outcome = ExploreOutcome::Aborted;
+            break;
+        }
+
+        ArtNode* node = worklist.back();
+        worklist.pop_back();
+        if (art.isCovered(node) || isDead(node)) {
+            continue;
+        }
+
+        // 解除覆盖的内部节点：重新处理因它被覆盖而跳过的后代
+        if (node->expanded) {
+            worklist.insert(worklist.end(), node->children.rbegin(), node->children.rend());
+            continue;
+        }
+
+        if (close(node)) {
+            continue;
+        }
+
+        // 未解决的检查点是错误位置：路径可行时报告，否则细化
+        const auto& instructions = node->location->getBasicBlock()->getInstructions();
+        bool hasSite = false;
+        for (auto* inst : instructions) {
+            hasSite = hasSite || (ObligationTracker::isCheckSite(inst) && !resolved.count(inst));
+        }
+        if (hasSite) {
+            std::vector<ArtNode*> path = art.pathTo(node);
+            SymbolicState state(nullptr);
+            for (size_t i = 0; i + 1 < path.size(); ++i) {
+                LLIRInstruction* terminator = nullptr;
+                const auto& pathInsts = path[i]->location->getBasicBlock()->getInstructions();
+                for (size_t k = 0; k < pathInsts.size(); ++k) {
+                    if (!pathInsts[k]) {
+                        continue;
+                    }
+                    if (isTerminator(pathInsts[k])) {
+                        terminator = pathInsts[k];
+                        continue;
+                    }
+                    executeInstruction(&state, pathInsts[k], path[i]->location, static_cast<int>(k));
+                }
+
+                Expr* guards[2] = {nullptr, nullptr};
+                if (terminator && terminator->getType() == LLIRInstructionType::Br) {
+                    branchGuards(&state, terminator, path[i]->location->getSuccessors().size(), guards);
+                }
+                if (path[i + 1]->succIndex < 2 && guards[path[i + 1]->succIndex]) {
+                    state.addConstraint(guards[path[i + 1]->succIndex]);
+                }
+            }
+
+            size_t checkedConstraints = 0;
+            SolverResult feasibility = SolverResult::Unknown;
+            for (size_t k = 0; k < instructions.size() && !isDead(node) && !art.isCovered(node); ++k) {
+                LLIRInstruction* inst = instructions[k];
+                if (!inst || isTerminator(inst)) {
+                    continue;
+                }
+                executeInstruction(&state, inst, node->location, static_cast<int>(k));
+                if (!ObligationTracker::isCheckSite(inst) || resolved.count(inst)) {
+                    continue;
+                }
+
+                // 约束没有变化时沿用上一个检查点的结论
+                size_t numConstraints = state.getPathConstraint()->getConstraints().size();
+                if (feasibility == SolverResult::Unknown || numConstraints != checkedConstraints) {
+                    ++lazyStats_.queries;
+                    feasibility = solver.check(state.getPathConstraint());
+                    checkedConstraints = numConstraints;
+                }
+
+                // 没有结论时与路径探索一样按可达处理
+                if (feasibility != SolverResult::Unsat) {
+                    checkVulnerabilities(&state, inst);
+                    resolved.insert(inst);
+                } else {
+                    refine(path, k + 1);
+                }
+            }
+            if (isDead(node) || art.isCovered(node)) {
+                continue;
+            }
+        }
+
+        const auto& successors = node->location->getSuccessors();
+        if (art.size() + successors.size() > maxNodes) {
+            utils::Logger::warning("Lazy abstraction reached the node budget in " + currentFunction_);
+            outcome = ExploreOutcome::Aborted;
+            break;
+        }
+        node->expanded = true;
+        for (size_t s = 0; s < successors.size(); ++s) {
+            art.addChild(node, successors[s], s);
+        }
+        worklist.insert(worklist.end(), node->children.rbegin(), node->children.rend());
+    }
+
+    lazyStats_.nodes += art.size();
+    lazyStats_.covered += art.getNumCovered();
+
+    // 树完整（每个叶子都已展开、被覆盖或不可行）时，其余检查点在任何路径上都不可达
+    if (outcome == ExploreOutcome::Completed) {
+        for (auto* bb : currentCFG_->getFunction()->getBasicBlocks()) {
+            for (auto* inst : bb->getInstructions()) {
+                if (!ObligationTracker::isCheckSite(inst) || resolved.count(inst)) {
+                    continue;
+                }
+                ++lazyStats_.proven;
+                utils::Logger::debug("Check site at " + inst->getLocation().toString() +
+                                     " proven unreachable by lazy abstraction");
+                if (obligations_ && obligations_->discharge(inst)) {
+                    obligationsChanged_ = true;
+                }
+            }
+        }
+    }
+
+    utils::Logger::info("Lazy abstraction finished: " + std::to_string(art.size()) + " nodes, " +
+                        std::to_string(art.getNumCovered()) + " covered");
+    return outcome;
+}
+
+std::vector<ArtStep> SymbolicExecutionEngine::encodePathSteps(
+    const std::vector<ArtNode*>& path,
+    size_t siteEnd
+) {
+    std::vector<ArtStep> steps(path.size());
+    for (size_t i = 0; i < path.size(); ++i) {
+        CFGNode* location = path[i]->location;
+        const auto& instructions = location->getBasicBlock()->getInstructions();
+        bool last = i + 1 == path.size();
+        size_t end = last ? std::min(siteEnd, instructions.size()) : instructions.size();
+
+        SymbolicState state(nullptr);
+        LLIRInstruction* terminator = nullptr;
+        for (size_t k = 0; k < end; ++k) {
+            if (!instructions[k]) {
+                continue;
+            }
+            if (isTerminator(instructions[k])) {
+                terminator = instructions[k];
+                continue;
+            }
+            executeInstruction(&state, instructions[k], location, static_cast<int>(k));
+        }
+
+        Expr* condition = nullptr;
+        for (Expr* constraint : state.getPathConstraint()->getConstraints()) {
+            condition = condition ? new BinaryOpExpr(BinaryOpType::LAnd, condition, constraint) : constraint;
+        }
+        if (!last && terminator && terminator->getType() == LLIRInstructionType::Br) {
+            Expr* guards[2] = {nullptr, nullptr};
+            branchGuards(&state, terminator, location->getSuccessors().size(), guards);
+            size_t succIndex = path[i + 1]->succIndex;
+            if (succIndex < 2 && guards[succIndex]) {
+                condition = condition
+                    ? new BinaryOpExpr(BinaryOpType::LAnd, condition, guards[succIndex]) : guards[succIndex];
+            }
+        }
+
+        steps[i].condition = condition;
+        steps[i].bindings = state.getStore()->getBindings();
+    }
+    return steps;
+}
+
+} // namespace core
+} // namespace cverifier
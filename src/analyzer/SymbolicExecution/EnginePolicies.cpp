@@ -0,0 +1,183 @@
+/**
+ * @file EnginePolicies.cpp
+ * @brief 探索策略类的非内联部分（覆盖引导、元策略、可行性缓存）
+ */
+
+#include "cverifier/EnginePolicies.h"
+#include "cverifier/EdgeCoverage.h"
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+/// UCB1：没用过的子策略先各用一次，之后取平均收益率加置信半径最大的
+size_t chooseArm(const BanditState& bandit) {
+    for (size_t arm = 0; arm < BanditState::kNumArms; ++arm) {
+        if (bandit.slices[arm] == 0) {
+            return arm;
+        }
+    }
+
+    // 收益率的量纲随程序变化：置信半径按目前最好的收益率缩放，都没有收益时轮流尝试
+    double best = *std::max_element(bandit.meanRate, bandit.meanRate + BanditState::kNumArms);
+    double scale = best > 0.0 ? best : 1.0;
+    double logTotal = std::log(static_cast<double>(bandit.totalSlices));
+
+    size_t choice = 0;
+    double choiceScore = -1.0;
+    for (size_t arm = 0; arm < BanditState::kNumArms; ++arm) {
+        double score = bandit.meanRate[arm] +
+                       scale * std::sqrt(2.0 * logTotal / static_cast<double>(bandit.slices[arm]));
+        if (score > choiceScore) {
+            choice = arm;
+            choiceScore = score;
+        }
+    }
+    return choice;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// CoverageSearcher 实现
+// ============================================================================
+
+ExplorationState* CoverageSearcher::select(Worklist& worklist, SearchContext& context) {
+    if (context.coverage) {
+        size_t scanned = 0;
+        for (auto it = worklist.rbegin(); it != worklist.rend() && scanned < kScanWindow; ++it, ++scanned) {
+            const ExplorationState* state = *it;
+            if (state->instructionIndex == 0 &&
+                !context.coverage->isCovered(state->previousNode, state->currentNode)) {
+                std::swap(*it, worklist.back());
+                break;
+            }
+        }
+    }
+    return DfsSearcher::select(worklist, context);
+}
+
+// ============================================================================
+// BanditSearcher 实现
+// ============================================================================
+
+ExplorationState* BanditSearcher::select(Worklist& worklist, SearchContext& context) {
+    BanditState& bandit = context.bandit;
+    auto now = std::chrono::steady_clock::now();
+
+    if (bandit.inSlice) {
+        double elapsedMs = std::chrono::duration<double, std::milli>(now - bandit.sliceStart).count();
+        bool sliceDone = context.deterministic ? bandit.sliceSelections >= kSliceSelections
+                                               : elapsedMs >= kSliceMs;
+        if (sliceDone) {
+            double cost = context.deterministic ? static_cast<double>(bandit.sliceSelections)
+                                                : std::max(elapsedMs, 1e-3);
+            double rate = static_cast<double>(context.rewards - bandit.sliceRewards) / cost;
+            size_t arm = bandit.arm;
+            ++bandit.slices[arm];
+            ++bandit.usedSlices[arm];
+            ++bandit.totalSlices;
+            bandit.meanRate[arm] += (rate - bandit.meanRate[arm]) / static_cast<double>(bandit.slices[arm]);
+            bandit.inSlice = false;
+        }
+    }
+
+    if (!bandit.inSlice) {
+        bandit.arm = chooseArm(bandit);
+        bandit.inSlice = true;
+        bandit.sliceSelections = 0;
+        bandit.sliceRewards = context.rewards;
+        bandit.sliceStart = now;
+    }
+    ++bandit.sliceSelections;
+
+    switch (bandit.arm) {
+        case 1:
+            return BfsSearcher::select(worklist, context);
+        case 2:
+            return RandomSearcher::select(worklist, context);
+        case 3:
+            return CoverageSearcher::select(worklist, context);
+        case 0:
+        default:
+            return DfsSearcher::select(worklist, context);
+    }
+}
+
+std::string BanditSearcher::getStatistics(const SearchContext& context) {
+    const BanditState& bandit = context.bandit;
+    std::ostringstream oss;
+    oss << "Bandit Searcher Statistics:\n";
+    for (size_t arm = 0; arm < BanditState::kNumArms; ++arm) {
+        oss << "  " << kArmNames[arm] << ": " << bandit.usedSlices[arm] << " slices\n";
+    }
+    return oss.str();
+}
+
+// ============================================================================
+// FeasibilityCache 实现
+// ============================================================================
+
+FeasibilityCache::Check FeasibilityCache::check(const PathConstraint& constraint) {
+    std::vector<uint64_t> hashes;
+    hashes.reserve(constraint.getConstraints().size());
+    for (Expr* expr : constraint.getConstraints()) {
+        hashes.push_back(expr->hash());
+    }
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+    // 与指纹独立的第二个组合：指纹碰撞时两者同时相等的概率可以忽略
+    Check result;
+    result.distinct = hashes.size();
+    for (uint64_t hash : hashes) {
+        result.mixed += utils::HashUtils::fnv1a(hash);
+    }
+    return result;
+}
+
+bool FeasibilityCache::lookup(const PathConstraint& constraint, bool& satisfiable) {
+    ++lookups_;
+    auto it = results_.find(constraint.getFingerprint());
+    if (it == results_.end()) {
+        return false;
+    }
+    if (!(it->second.check == check(constraint))) {
+        ++collisions_;
+        return false;
+    }
+
+    ++hits_;
+    satisfiable = it->second.satisfiable;
+    return true;
+}
+
+void FeasibilityCache::insert(const PathConstraint& constraint, bool satisfiable) {
+    // 超过上限时整体清空：结论可以随时重新求解，清空只损失命中率
+    if (results_.size() >= kMaxEntries) {
+        results_.clear();
+        ++clears_;
+    }
+    results_[constraint.getFingerprint()] = Entry{check(constraint), satisfiable};
+}
+
+std::string FeasibilityCache::getStatistics() const {
+    std::ostringstream oss;
+    oss << "Feasibility Cache Statistics:\n";
+    oss << "  Lookups: " << lookups_ << "\n";
+    oss << "  Hits: " << hits_ << "\n";
+    oss << "  Entries: " << results_.size() << "\n";
+    oss << "  Collisions: " << collisions_ << "\n";
+    oss << "  Clears: " << clears_ << "\n";
+    return oss.str();
+}
+
+} // namespace core
+} // namespace cverifier
@@ -0,0 +1,115 @@
+/**
+ * @file EngineResources.cpp
+ * @brief 符号执行引擎：资源调度、目标终止与表达式回收
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+
+namespace cverifier {
+namespace core {
+
+// ============================================================================
+// 资源调度
+// ============================================================================
+
+void SymbolicExecutionEngine::configureGovernor() {
+    if (!config_.enableResourceGovernor) {
+        governor_.reset();
+        return;
+    }
+
+    GovernorConfig governorConfig;
+    governorConfig.totalTimeSec = config_.timeout;
+    governorConfig.totalStates = config_.maxStates;
+    governorConfig.memoryLimitMB = static_cast<size_t>(std::max(config_.memoryLimitMB, 0));
+    governorConfig.solverTimeSec = config_.solverTimeBudget;
+    governorConfig.pathTimeSec = config_.timeoutPerPath;
+    governorConfig.pathMaxSteps = config_.maxDepth;
+    governorConfig.pathMemoryMB = static_cast<size_t>(std::max(config_.memoryPerPathMB, 0));
+    governorConfig.pathSolverSec = config_.solverTimePerPath;
+
+    // 确定性模式：时间和常驻内存随负载变化，只保留按状态数/基本块步数和
+    // 状态估算大小计量的预算
+    if (config_.deterministic) {
+        governorConfig.totalTimeSec = 0.0;
+        governorConfig.memoryLimitMB = 0;
+        governorConfig.solverTimeSec = 0.0;
+        governorConfig.pathTimeSec = 0.0;
+        governorConfig.pathSolverSec = 0.0;
+    }
+
+    governor_ = std::make_unique<ResourceGovernor>(governorConfig);
+}
+
+PathUsage SymbolicExecutionEngine::currentPathUsage() const {
+    if (!currentExploration_) {
+        return {};
+    }
+
+    // 子路径继承父路径的消耗，包括当前基本块已执行的部分
+    PathUsage usage = currentExploration_->usage;
+    usage.wallClockMs += stepTimer_.elapsedMs();
+    return usage;
+}
+
+// ============================================================================
+// 目标终止
+// ============================================================================
+
+bool SymbolicExecutionEngine::hasPendingObligations() const {
+    std::vector<const CFGNode*> frontier;
+    for (const ExplorationState* explState : worklist_) {
+        frontier.push_back(explState->currentNode);
+    }
+    for (const auto& [ticket, explState] : parked_) {
+        frontier.push_back(explState->currentNode);
+    }
+    return obligations_->hasPending(frontier);
+}
+
+void SymbolicExecutionEngine::releaseObligations() {
+    if (obligations_) {
+        goalStats_.reported += obligations_->getNumReported();
+        obligations_.reset();
+    }
+}
+
+// ============================================================================
+// 表达式回收
+// ============================================================================
+
+void SymbolicExecutionEngine::collectExprs() {
+    utils::Timer timer;
+    exprHeap_.beginCollection();
+    auto mark = [this](const Expr* expr) { exprHeap_.mark(expr); };
+    auto markWorklist = [&mark](const Worklist& worklist) {
+        for (const ExplorationState* explorationState : worklist) {
+            if (explorationState->symbolicState) {
+                explorationState->symbolicState->forEachExpr(mark);
+            }
+        }
+    };
+
+    markWorklist(worklist_);
+    for (const auto& fn : suspended_) {
+        markWorklist(fn.worklist);
+    }
+    for (const auto& [ticket, explorationState] : parked_) {
+        explorationState->symbolicState->forEachExpr(mark);
+    }
+    for (const SymbolicState* state : reachedStates_) {
+        state->forEachExpr(mark);
+    }
+
+    size_t retired = exprHeap_.sweep();
+    size_t freed = exprHeap_.reclaim();
+    utils::Logger::debug("Expression collection: " + std::to_string(retired) + " retired, " +
+                         std::to_string(freed) + " freed, " +
+                         std::to_string(exprHeap_.getNumTracked()) + " live (" +
+                         std::to_string(timer.elapsedMs()) + " ms)");
+}
+
+} // namespace core
+} // namespace cverifier
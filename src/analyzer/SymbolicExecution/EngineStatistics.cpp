@@ -0,0 +1,180 @@
+/**
+ * @file EngineStatistics.cpp
+ * @brief 探索计数与各探索模式统计实现
+ */
+
+#include "cverifier/EngineStatistics.h"
+#include <sstream>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+/**
+ * @brief 探索计数的字段表：名称用于 fork 统计记录
+ */
+template <typename Visitor>
+void forEachCounter(Visitor&& visit) {
+    visit("paths", &ExplorationCounters::paths);
+    visit("pruned", &ExplorationCounters::prunedPaths);
+    visit("infeasible", &ExplorationCounters::infeasiblePaths);
+    visit("accelerated", &ExplorationCounters::acceleratedLoops);
+    visit("duplicates", &ExplorationCounters::duplicateStates);
+    visit("dead", &ExplorationCounters::deadBindings);
+    visit("concretized", &ExplorationCounters::concretizedExprs);
+    visit("abstracted", &ExplorationCounters::abstractedExprs);
+    visit("lazy-pruned", &ExplorationCounters::lazyPrunedForks);
+    visit("lazy-decided", &ExplorationCounters::lazyDecidedForks);
+    visit("in-place", &ExplorationCounters::inPlaceForks);
+}
+
+/// 解析一个非负整数字段，整个值都必须是数字
+template <typename T>
+bool parseField(const std::string& text, T& value) {
+    std::istringstream iss(text);
+    long long parsed = 0;
+    if (text.empty() || text[0] == '-' || !(iss >> parsed) || !iss.eof()) {
+        return false;
+    }
+    value = static_cast<T>(parsed);
+    return true;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// ExplorationCounters 实现
+// ============================================================================
+
+ExplorationCounters& ExplorationCounters::operator+=(const ExplorationCounters& other) {
+    forEachCounter([&](const char*, auto member) {
+        this->*member += other.*member;
+    });
+    return *this;
+}
+
+ExplorationCounters ExplorationCounters::operator-(const ExplorationCounters& other) const {
+    ExplorationCounters result;
+    forEachCounter([&](const char*, auto member) {
+        result.*member = this->*member - other.*member;
+    });
+    return result;
+}
+
+// ============================================================================
+// ForkSubtreeStats 实现
+// ============================================================================
+
+std::string ForkSubtreeStats::encode() const {
+    std::ostringstream oss;
+    forEachCounter([&](const char* name, auto member) {
+        oss << name << "=" << counters.*member << " ";
+    });
+    oss << "states=" << states << " complete=" << (complete ? 1 : 0);
+    return oss.str();
+}
+
+bool ForkSubtreeStats::decode(const std::string& line, ForkSubtreeStats& stats) {
+    stats = ForkSubtreeStats();
+    std::istringstream iss(line);
+    std::string field;
+    while (iss >> field) {
+        size_t equals = field.find('=');
+        if (equals == std::string::npos) {
+            return false;
+        }
+        std::string name = field.substr(0, equals);
+        std::string value = field.substr(equals + 1);
+
+        bool known = false;
+        bool parsed = false;
+        forEachCounter([&](const char* counter, auto member) {
+            if (!known && name == counter) {
+                known = true;
+                parsed = parseField(value, stats.counters.*member);
+            }
+        });
+        if (!known && name == "states") {
+            known = true;
+            parsed = parseField(value, stats.states);
+        } else if (!known && name == "complete") {
+            known = true;
+            parsed = value == "0" || value == "1";
+            stats.complete = value == "1";
+        }
+        if (!known || !parsed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// 各探索模式的统计
+// ============================================================================
+
+std::string ForkStats::getStatistics() const {
+    std::ostringstream oss;
+    oss << "Fork Mode Statistics:\n";
+    oss << "  Subtrees: " << subtrees << "\n";
+    oss << "  Failed Subtrees: " << failed << "\n";
+    return oss.str();
+}
+
+std::string GoalStats::getStatistics() const {
+    std::ostringstream oss;
+    oss << "Goal Termination Statistics:\n";
+    oss << "  Check Obligations: " << obligations << "\n";
+    oss << "  Reported Obligations: " << reported << "\n";
+    oss << "  Functions Terminated Early: " << terminatedFunctions << "\n";
+    return oss.str();
+}
+
+std::string BoundedStats::getStatistics(int bound) const {
+    std::ostringstream oss;
+    oss << "Bounded Model Checking Statistics:\n";
+    oss << "  Bound: " << bound << "\n";
+    oss << "  Unrolled Blocks: " << blocks << "\n";
+    oss << "  SSA Definitions: " << definitions << "\n";
+    oss << "  Truncated Back Edges: " << truncated << "\n";
+    oss << "  Solver Queries: " << queries << "\n";
+    return oss.str();
+}
+
+std::string InductionStats::getStatistics(int k) const {
+    std::ostringstream oss;
+    oss << "k-Induction Statistics:\n";
+    oss << "  k: " << k << "\n";
+    oss << "  Candidate Sites: " << candidates << "\n";
+    oss << "  Proven Safe: " << proven << "\n";
+    oss << "  Proof Queries: " << queries << "\n";
+    return oss.str();
+}
+
+std::string LazyStats::getStatistics() const {
+    std::ostringstream oss;
+    oss << "Lazy Abstraction Statistics:\n";
+    oss << "  ART Nodes: " << nodes << "\n";
+    oss << "  Covered Nodes: " << covered << "\n";
+    oss << "  Refinements: " << refinements << "\n";
+    oss << "  Proven Safe: " << proven << "\n";
+    oss << "  Solver Queries: " << queries << "\n";
+    return oss.str();
+}
+
+std::string FuzzStats::getStatistics(const char* backend) const {
+    std::ostringstream oss;
+    oss << "Hybrid Fuzzing Statistics:\n";
+    oss << "  Backend: " << backend << "\n";
+    oss << "  Executions: " << executions << "\n";
+    oss << "  Corpus Size: " << corpus << "\n";
+    oss << "  Covered Branch Outcomes: " << outcomes << "\n";
+    oss << "  Plateaus Handed Off: " << handoffs << "\n";
+    oss << "  Solver Queries: " << queries << "\n";
+    oss << "  Solver Seeds: " << solvedSeeds << "\n";
+    return oss.str();
+}
+
+} // namespace core
+} // namespace cverifier
@@ -0,0 +1,294 @@
+/**
+ * @file ForkExplorer.cpp
+ * @brief 进程级 fork 探索实现
+ */
+
+#include "cverifier/ForkExplorer.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define CVERIFIER_HAVE_FORK 1
+#endif
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+/// 子进程退出码：任务抛出异常 / 内存耗尽
+constexpr int kExitException = 70;
+constexpr int kExitOutOfMemory = 71;
+
+/// 取消检查间隔（毫秒）
+constexpr int kPollIntervalMs = 100;
+
+} // anonymous namespace
+
+// ============================================================================
+// ForkOutcome 实现
+// ============================================================================
+
+std::string ForkOutcome::describe() const {
+    if (signal != 0) {
+        return "killed by signal " + std::to_string(signal);
+    }
+    if (exitCode == kExitOutOfMemory) {
+        return "out of memory";
+    }
+    if (exitCode == kExitException) {
+        return "uncaught exception";
+    }
+    if (!finished) {
+        return "exited with code " + std::to_string(exitCode) + " before finishing";
+    }
+    return "finished";
+}
+
+// ============================================================================
+// ForkExplorer 实现
+// ============================================================================
+
+ForkExplorer::ForkExplorer(ForkLimits limits, CancellationToken* token)
+    : limits_(limits), token_(token) {}
+
+bool ForkExplorer::isSupported() {
+#ifdef CVERIFIER_HAVE_FORK
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ForkExplorer::writeRecord(int fd, const std::string& record) {
+#ifdef CVERIFIER_HAVE_FORK
+    std::string line = record + "\n";
+    const char* data = line.data();
+    size_t remaining = line.size();
+    while (remaining > 0) {
+        ssize_t written = ::write(fd, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    return true;
+#else
+    (void)fd;
+    (void)record;
+    return false;
+#endif
+}
+
+std::vector<ForkOutcome> ForkExplorer::run(
+    size_t numTasks,
+    size_t maxConcurrent,
+    const ChildTask& task,
+    const RecordHandler& onRecord
+) {
+    std::vector<ForkOutcome> outcomes(numTasks);
+
+#ifdef CVERIFIER_HAVE_FORK
+    struct Child {
+        size_t index;
+        pid_t pid;
+        int fd;
+        std::string buffer;
+    };
+
+    std::vector<Child> running;
+    size_t nextTask = 0;
+    bool cancelled = false;
+    maxConcurrent = std::max<size_t>(maxConcurrent, 1);
+
+    auto spawn = [&](size_t index) -> bool {
+        int fds[2];
+        if (::pipe(fds) != 0) {
+            utils::Logger::error(std::string("pipe() failed: ") + std::strerror(errno));
+            return false;
+        }
+
+        // 未刷新的输出缓冲会被复制到子进程，先刷新避免重复输出
+        std::cout.flush();
+        std::fflush(nullptr);
+
+        pid_t pid = ::fork();
+        if (pid < 0) {
+            utils::Logger::error(std::string("fork() failed: ") + std::strerror(errno));
+            ::close(fds[0]);
+            ::close(fds[1]);
+            return false;
+        }
+
+        if (pid == 0) {
+            // 子进程：只保留自己的写端
+            ::close(fds[0]);
+            for (const auto& other : running) {
+                ::close(other.fd);
+            }
+
+            if (limits_.memoryLimitMB > 0) {
+                rlimit limit;
+                limit.rlim_cur = limit.rlim_max =
+                    static_cast<rlim_t>(limits_.memoryLimitMB) * 1024 * 1024;
+                ::setrlimit(RLIMIT_AS, &limit);
+            }
+            if (limits_.cpuSeconds > 0) {
+                rlimit limit;
+                limit.rlim_cur = limit.rlim_max = static_cast<rlim_t>(limits_.cpuSeconds);
+                ::setrlimit(RLIMIT_CPU, &limit);
+            }
+
+            // 不运行父进程注册的 atexit 处理器和静态析构
+            int code = 0;
+            try {
+                code = task(index, fds[1]);
+                if (code == 0) {
+                    writeRecord(fds[1], kEndRecord);
+                }
+            } catch (const std::bad_alloc&) {
+                code = kExitOutOfMemory;
+            } catch (...) {
+                code = kExitException;
+            }
+            ::close(fds[1]);
+            std::cout.flush();
+            std::fflush(nullptr);
+            ::_exit(code);
+        }
+
+        ::close(fds[1]);
+        outcomes[index].pid = static_cast<int>(pid);
+        running.push_back({index, pid, fds[0], std::string()});
+        return true;
+    };
+
+    auto reap = [&](Child& child) {
+        // 管道末尾可能有不完整的一行（子进程写到一半时崩溃），丢弃
+        ::close(child.fd);
+
+        int status = 0;
+        while (::waitpid(child.pid, &status, 0) < 0 && errno == EINTR) {}
+
+        ForkOutcome& outcome = outcomes[child.index];
+        if (WIFEXITED(status)) {
+            outcome.exitCode = WEXITSTATUS(status);
+            outcome.finished = outcome.finished && outcome.exitCode == 0;
+        } else {
+            outcome.finished = false;
+            if (WIFSIGNALED(status)) {
+                outcome.signal = WTERMSIG(status);
+            }
+        }
+
+        if (!outcome.finished) {
+            utils::Logger::warning("Fork subtree " + std::to_string(child.index) + " (pid " +
+                                   std::to_string(child.pid) + ") failed: " + outcome.describe());
+        }
+    };
+
+    while (nextTask < numTasks || !running.empty()) {
+        // 补足并发子进程
+        while (!cancelled && nextTask < numTasks && running.size() < maxConcurrent) {
+            if (!spawn(nextTask)) {
+                // 无法 fork：剩余任务标记为失败
+                nextTask = numTasks;
+                break;
+            }
+            ++nextTask;
+        }
+
+        if (running.empty()) {
+            break;
+        }
+
+        if (!cancelled && token_ && token_->isCancelled()) {
+            cancelled = true;
+            nextTask = numTasks;
+            for (const auto& child : running) {
+                ::kill(child.pid, SIGKILL);
+            }
+        }
+
+        std::vector<pollfd> fds;
+        for (const auto& child : running) {
+            fds.push_back({child.fd, POLLIN, 0});
+        }
+
+        int ready = ::poll(fds.data(), fds.size(), kPollIntervalMs);
+        if (ready < 0 && errno != EINTR) {
+            utils::Logger::error(std::string("poll() failed: ") + std::strerror(errno));
+            break;
+        }
+        if (ready <= 0) {
+            continue;
+        }
+
+        for (size_t i = fds.size(); i-- > 0;) {
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR))) {
+                continue;
+            }
+
+            Child& child = running[i];
+            char buf[4096];
+            ssize_t n = ::read(child.fd, buf, sizeof(buf));
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+
+            if (n > 0) {
+                child.buffer.append(buf, static_cast<size_t>(n));
+                size_t newline;
+                while ((newline = child.buffer.find('\n')) != std::string::npos) {
+                    std::string record = child.buffer.substr(0, newline);
+                    child.buffer.erase(0, newline + 1);
+
+                    ForkOutcome& outcome = outcomes[child.index];
+                    if (record == kEndRecord) {
+                        outcome.finished = true;
+                    } else {
+                        ++outcome.records;
+                        onRecord(child.index, record);
+                    }
+                }
+                continue;
+            }
+
+            // EOF：子进程已关闭管道
+            reap(child);
+            running.erase(running.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+    }
+
+    // poll 失败时的兜底：不留下僵尸进程
+    for (auto& child : running) {
+        ::kill(child.pid, SIGKILL);
+        reap(child);
+    }
+#else
+    (void)maxConcurrent;
+    (void)task;
+    (void)onRecord;
+    utils::Logger::error("Fork mode is not supported on this platform");
+#endif
+
+    return outcomes;
+}
+
+} // namespace core
+} // namespace cverifier
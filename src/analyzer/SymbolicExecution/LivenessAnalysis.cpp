@@ -0,0 +1,207 @@
+/**
+ * @file LivenessAnalysis.cpp
+ * @brief 活跃变量分析实现
+ */
+
+#include "cverifier/LivenessAnalysis.h"
+#include "cverifier/LLIRValue.h"
+#include <unordered_set>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+/// 引擎为结果建立绑定的指令
+bool definesResult(const LLIRInstruction* inst) {
+    switch (inst->getType()) {
+        case LLIRInstructionType::Add:
+        case LLIRInstructionType::Sub:
+        case LLIRInstructionType::Mul:
+        case LLIRInstructionType::Div:
+        case LLIRInstructionType::Rem:
+        case LLIRInstructionType::ICmp:
+        case LLIRInstructionType::FCmp:
+        case LLIRInstructionType::GetElementPtr:
+        case LLIRInstructionType::Call:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// 读取指针操作数所指单元的指令
+bool readsCells(const LLIRInstruction* inst) {
+    return inst->getType() == LLIRInstructionType::Call ||
+           inst->getType() == LLIRInstructionType::GetElementPtr;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// LivenessAnalysis 实现
+// ============================================================================
+
+LivenessAnalysis::LivenessAnalysis(
+    CFG* cfg,
+    const std::unordered_map<const LLIRInstruction*, std::string>& resultNames
+) : resultNames_(resultNames) {
+    std::vector<CFGNode*> order;
+    std::unordered_map<const CFGNode*, std::pair<std::vector<size_t>, std::vector<size_t>>> local;
+
+    for (auto* bb : cfg->getFunction()->getBasicBlocks()) {
+        CFGNode* node = cfg->getNode(bb->getName());
+        if (!node) {
+            continue;
+        }
+        order.push_back(node);
+
+        // 块内先读后写的名字进入 use，写入的名字进入 def
+        auto& [uses, defs] = local[node];
+        std::unordered_set<size_t> written;
+        auto read = [&](const std::string& name) {
+            if (name.empty()) {
+                return;
+            }
+            size_t i = index(name);
+            if (!written.count(i)) {
+                uses.push_back(i);
+            }
+        };
+        auto write = [&](const std::string& name) {
+            if (name.empty()) {
+                return;
+            }
+            size_t i = index(name);
+            written.insert(i);
+            defs.push_back(i);
+        };
+
+        for (auto* inst : bb->getInstructions()) {
+            if (!inst) {
+                continue;
+            }
+            const auto& operands = inst->getOperands();
+
+            for (LLIRValue* operand : operands) {
+                // 分支目标是 Void 类型的具名变量，不是数据
+                auto* target = dynamic_cast<LLIRVariable*>(operand);
+                if (target && target->getType() == ValueType::Void) {
+                    continue;
+                }
+                std::string name = valueName(operand);
+                read(name);
+                if (readsCells(inst) && !name.empty()) {
+                    read("*" + name);
+                }
+            }
+
+            if (inst->getType() == LLIRInstructionType::Load && !operands.empty()) {
+                std::string ptr = valueName(operands[0]);
+                if (!ptr.empty()) {
+                    read("*" + ptr);
+                    write(valueName(inst));
+                }
+            } else if (inst->getType() == LLIRInstructionType::Store && operands.size() == 2) {
+                std::string ptr = valueName(operands[1]);
+                if (!ptr.empty()) {
+                    write("*" + ptr);
+                }
+            } else if (definesResult(inst)) {
+                write(valueName(inst));
+            }
+        }
+    }
+
+    const size_t words = (names_.size() + 63) / 64;
+    for (CFGNode* node : order) {
+        BlockSets& sets = blocks_[node];
+        sets.use.assign(words, 0);
+        sets.def.assign(words, 0);
+        sets.in.assign(words, 0);
+        sets.out.assign(words, 0);
+        for (size_t i : local[node].first) {
+            sets.use[i / 64] |= uint64_t{1} << (i % 64);
+        }
+        for (size_t i : local[node].second) {
+            sets.def[i / 64] |= uint64_t{1} << (i % 64);
+        }
+    }
+
+    // 后向分析：按块的逆序迭代到不动点
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        ++iterations_;
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            BlockSets& sets = blocks_[*it];
+            for (CFGNode* succ : (*it)->getSuccessors()) {
+                auto found = blocks_.find(succ);
+                if (found == blocks_.end()) {
+                    continue;
+                }
+                for (size_t w = 0; w < words; ++w) {
+                    sets.out[w] |= found->second.in[w];
+                }
+            }
+            for (size_t w = 0; w < words; ++w) {
+                uint64_t in = sets.use[w] | (sets.out[w] & ~sets.def[w]);
+                if (in != sets.in[w]) {
+                    sets.in[w] = in;
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
+bool LivenessAnalysis::isLiveIn(const CFGNode* node, const std::string& name) const {
+    auto it = blocks_.find(node);
+    // 分析之外的节点保守地认为所有名字都活跃
+    return it == blocks_.end() || test(it->second.in, name);
+}
+
+bool LivenessAnalysis::isLiveOut(const CFGNode* node, const std::string& name) const {
+    auto it = blocks_.find(node);
+    return it == blocks_.end() || test(it->second.out, name);
+}
+
+std::string LivenessAnalysis::valueName(const LLIRValue* value) const {
+    // 与引擎的 operandToExpr / cellName 相同
+    if (auto* inst = dynamic_cast<const LLIRInstruction*>(value)) {
+        auto it = resultNames_.find(inst);
+        return it != resultNames_.end()
+            ? it->second : "%" + std::to_string(reinterpret_cast<uintptr_t>(inst));
+    }
+    if (auto* var = dynamic_cast<const LLIRVariable*>(value)) {
+        return var->getName();
+    }
+    if (auto* arg = dynamic_cast<const LLIRArgument*>(value)) {
+        return arg->getName();
+    }
+    if (auto* global = dynamic_cast<const LLIRGlobalVariable*>(value)) {
+        return global->getName();
+    }
+    return "";
+}
+
+size_t LivenessAnalysis::index(const std::string& name) {
+    auto it = names_.find(name);
+    if (it != names_.end()) {
+        return it->second;
+    }
+    size_t i = names_.size();
+    names_[name] = i;
+    return i;
+}
+
+bool LivenessAnalysis::test(const Bits& bits, const std::string& name) const {
+    auto it = names_.find(name);
+    if (it == names_.end()) {
+        return false;
+    }
+    return (bits[it->second / 64] >> (it->second % 64)) & 1;
+}
+
+} // namespace core
+} // namespace cverifier
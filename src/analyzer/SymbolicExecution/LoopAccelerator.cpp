@@ -0,0 +1,337 @@
+/**
+ * @file LoopAccelerator.cpp
+ * @brief 循环加速分析实现
+ */
+
+#include "cverifier/LoopAccelerator.h"
+#include "cverifier/LLIRValue.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+#include <unordered_set>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+std::string slotName(const LLIRValue* value) {
+    if (auto* var = dynamic_cast<const LLIRVariable*>(value)) {
+        return var->getName();
+    }
+    if (auto* arg = dynamic_cast<const LLIRArgument*>(value)) {
+        return arg->getName();
+    }
+    if (auto* global = dynamic_cast<const LLIRGlobalVariable*>(value)) {
+        return global->getName();
+    }
+    return "";
+}
+
+const LLIRInstruction* asInstruction(const LLIRValue* value, LLIRInstructionType type) {
+    auto* inst = dynamic_cast<const LLIRInstruction*>(value);
+    return inst && inst->getType() == type ? inst : nullptr;
+}
+
+bool isIntConstant(const LLIRValue* value, int64_t& out) {
+    auto* constant = dynamic_cast<const LLIRConstant*>(value);
+    if (!constant || !constant->isInteger()) {
+        return false;
+    }
+    out = constant->getIntValue();
+    return true;
+}
+
+/**
+ * @brief value 是否是循环内对 slot 的 load
+ */
+bool isLoadOf(const LLIRValue* value, const LLIRValue* slot,
+              const std::unordered_set<const LLIRValue*>& loopInstructions) {
+    auto* load = asInstruction(value, LLIRInstructionType::Load);
+    return load && loopInstructions.count(load) && !load->getOperands().empty() &&
+           LoopAccelerator::sameSlot(load->getOperands()[0], slot);
+}
+
+LLIRCmpPredicate swapPredicate(LLIRCmpPredicate predicate) {
+    switch (predicate) {
+        case LLIRCmpPredicate::LT: return LLIRCmpPredicate::GT;
+        case LLIRCmpPredicate::LE: return LLIRCmpPredicate::GE;
+        case LLIRCmpPredicate::GT: return LLIRCmpPredicate::LT;
+        case LLIRCmpPredicate::GE: return LLIRCmpPredicate::LE;
+        default: return predicate;
+    }
+}
+
+LLIRCmpPredicate negatePredicate(LLIRCmpPredicate predicate) {
+    switch (predicate) {
+        case LLIRCmpPredicate::LT: return LLIRCmpPredicate::GE;
+        case LLIRCmpPredicate::LE: return LLIRCmpPredicate::GT;
+        case LLIRCmpPredicate::GT: return LLIRCmpPredicate::LE;
+        case LLIRCmpPredicate::GE: return LLIRCmpPredicate::LT;
+        case LLIRCmpPredicate::EQ: return LLIRCmpPredicate::NE;
+        case LLIRCmpPredicate::NE: return LLIRCmpPredicate::EQ;
+        default: return predicate;
+    }
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// AcceleratedLoop 实现
+// ============================================================================
+
+bool AcceleratedLoop::contains(const CFGNode* node) const {
+    return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+}
+
+// ============================================================================
+// LoopAccelerator 实现
+// ============================================================================
+
+LoopAccelerator::LoopAccelerator(CFG* cfg) {
+    if (!cfg) {
+        return;
+    }
+
+    // 同一个循环头有多条回边时（continue 等）不加速
+    std::unordered_map<const CFGNode*, int> backEdgeCount;
+    auto loops = cfg->findLoops();
+    for (const auto& loopNodes : loops) {
+        backEdgeCount[loopNodes.front()]++;
+    }
+
+    for (const auto& loopNodes : loops) {
+        ++numLoops_;
+
+        AcceleratedLoop loop;
+        std::string reason;
+        if (backEdgeCount[loopNodes.front()] != 1) {
+            reason = "multiple back edges";
+        } else if (analyze(loopNodes, loop, reason)) {
+            utils::Logger::debug("Loop at " + loop.header->getId() + " is accelerable (" +
+                                 std::to_string(loop.inductionVariables.size()) +
+                                 " induction variables)");
+            loops_[loop.header] = std::move(loop);
+            continue;
+        }
+
+        utils::Logger::debug("Loop at " + loopNodes.front()->getId() +
+                             " not accelerable: " + reason);
+    }
+}
+
+const AcceleratedLoop* LoopAccelerator::getLoop(const CFGNode* header) const {
+    auto it = loops_.find(header);
+    return it != loops_.end() ? &it->second : nullptr;
+}
+
+bool LoopAccelerator::sameSlot(const LLIRValue* a, const LLIRValue* b) {
+    if (!a || !b) {
+        return false;
+    }
+    if (a == b) {
+        return true;
+    }
+
+    std::string nameA = slotName(a);
+    return !nameA.empty() && nameA == slotName(b);
+}
+
+bool LoopAccelerator::analyze(
+    const std::vector<CFGNode*>& loopNodes,
+    AcceleratedLoop& loop,
+    std::string& reason
+) const {
+    CFGNode* header = loopNodes.front();
+    std::unordered_set<const CFGNode*> inLoop(loopNodes.begin(), loopNodes.end());
+
+    // 循环头：条件分支，一个后继在循环内，一个在循环外
+    const auto& headerInsts = header->getBasicBlock()->getInstructions();
+    if (headerInsts.empty() || headerInsts.back()->getType() != LLIRInstructionType::Br ||
+        headerInsts.back()->getOperands().size() != 3 || header->getSuccessors().size() != 2) {
+        reason = "header does not end in a conditional branch";
+        return false;
+    }
+
+    LLIRInstruction* branch = headerInsts.back();
+    CFGNode* body = nullptr;
+    for (auto* succ : header->getSuccessors()) {
+        if (inLoop.count(succ)) {
+            body = body ? nullptr : succ;
+        } else {
+            loop.exit = succ;
+        }
+    }
+    if (!body || !loop.exit) {
+        reason = "header must have exactly one exit";
+        return false;
+    }
+
+    auto* thenTarget = dynamic_cast<LLIRVariable*>(branch->getOperands()[1]);
+    loop.continueOnTrue = thenTarget && thenTarget->getName() == body->getId();
+
+    // 循环体：从循环头出发、回到循环头的一条链
+    loop.header = header;
+    loop.branch = branch;
+    loop.nodes.push_back(header);
+    for (CFGNode* node = body; node != header; node = node->getSuccessors().front()) {
+        const auto& insts = node->getBasicBlock()->getInstructions();
+        if (!inLoop.count(node) || loop.contains(node) || node->getSuccessors().size() != 1 ||
+            insts.empty() || insts.back()->getType() != LLIRInstructionType::Br) {
+            reason = "loop body is not a straight-line chain";
+            return false;
+        }
+        loop.nodes.push_back(node);
+    }
+    if (loop.nodes.size() != loopNodes.size()) {
+        reason = "loop body is not a straight-line chain";
+        return false;
+    }
+
+    // 收集循环中的指令和写入
+    std::unordered_set<const LLIRValue*> loopInstructions;
+    std::vector<LLIRInstruction*> stores;
+    for (auto* node : loop.nodes) {
+        for (auto* inst : node->getBasicBlock()->getInstructions()) {
+            loopInstructions.insert(inst);
+
+            switch (inst->getType()) {
+                case LLIRInstructionType::Call:
+                    reason = "loop contains a call";
+                    return false;
+                case LLIRInstructionType::Phi:
+                    reason = "loop contains a phi";
+                    return false;
+                case LLIRInstructionType::Store:
+                    if (node == header) {
+                        reason = "loop header writes memory";
+                        return false;
+                    }
+                    if (inst->getOperands().size() == 2) {
+                        stores.push_back(inst);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // 归纳变量：只被写入一次，且写入值为 load + 常量 或 load - 常量
+    std::vector<LLIRValue*> slots;
+    for (auto* store : stores) {
+        LLIRValue* slot = store->getOperands()[1];
+        bool seen = std::any_of(slots.begin(), slots.end(),
+                                [&](LLIRValue* s) { return sameSlot(s, slot); });
+        if (!seen) {
+            slots.push_back(slot);
+        }
+    }
+
+    for (auto* slot : slots) {
+        LLIRInstruction* onlyStore = nullptr;
+        int storeCount = 0;
+        for (auto* store : stores) {
+            if (sameSlot(store->getOperands()[1], slot)) {
+                onlyStore = store;
+                ++storeCount;
+            }
+        }
+
+        int64_t step = 0;
+        if (storeCount == 1) {
+            const LLIRValue* value = onlyStore->getOperands()[0];
+            auto* inst = dynamic_cast<const LLIRInstruction*>(value);
+            if (inst && loopInstructions.count(inst) && inst->getOperands().size() == 2) {
+                const auto& ops = inst->getOperands();
+                int64_t constant = 0;
+                if (inst->getType() == LLIRInstructionType::Add) {
+                    if (isLoadOf(ops[0], slot, loopInstructions) && isIntConstant(ops[1], constant)) {
+                        step = constant;
+                    } else if (isLoadOf(ops[1], slot, loopInstructions) &&
+                               isIntConstant(ops[0], constant)) {
+                        step = constant;
+                    }
+                } else if (inst->getType() == LLIRInstructionType::Sub) {
+                    if (isLoadOf(ops[0], slot, loopInstructions) && isIntConstant(ops[1], constant)) {
+                        step = -constant;
+                    }
+                }
+            }
+        }
+
+        if (step != 0) {
+            loop.inductionVariables.push_back({slot, step});
+        } else {
+            loop.clobbered.push_back(slot);
+        }
+    }
+
+    // 循环条件：归纳变量与循环不变量的比较
+    auto* cmp = asInstruction(branch->getOperands()[0], LLIRInstructionType::ICmp);
+    if (!cmp || cmp->getOperands().size() != 2 ||
+        std::find(headerInsts.begin(), headerInsts.end(), cmp) == headerInsts.end()) {
+        reason = "loop condition is not an integer comparison in the header";
+        return false;
+    }
+
+    const InductionVariable* iv = nullptr;
+    const LLIRValue* bound = nullptr;
+    LLIRCmpPredicate predicate = cmp->getPredicate();
+    for (const auto& candidate : loop.inductionVariables) {
+        if (isLoadOf(cmp->getOperands()[0], candidate.slot, loopInstructions)) {
+            iv = &candidate;
+            bound = cmp->getOperands()[1];
+        } else if (isLoadOf(cmp->getOperands()[1], candidate.slot, loopInstructions)) {
+            iv = &candidate;
+            bound = cmp->getOperands()[0];
+            predicate = swapPredicate(predicate);
+        }
+        if (iv) {
+            break;
+        }
+    }
+    if (!iv) {
+        reason = "loop condition does not test an induction variable";
+        return false;
+    }
+
+    // 界：常量、具名值、循环外的指令结果，或循环中没有写入的单元的 load
+    int64_t ignored = 0;
+    bool invariant = isIntConstant(bound, ignored) || !slotName(bound).empty() ||
+                     (dynamic_cast<const LLIRInstruction*>(bound) && !loopInstructions.count(bound));
+    if (auto* load = asInstruction(bound, LLIRInstructionType::Load)) {
+        invariant = !load->getOperands().empty() &&
+                    std::none_of(slots.begin(), slots.end(), [&](LLIRValue* s) {
+                        return sameSlot(s, load->getOperands()[0]);
+                    });
+    }
+    if (!invariant) {
+        reason = "loop bound is not loop-invariant";
+        return false;
+    }
+
+    // 继续条件必须随迭代单调地由真变假
+    LLIRCmpPredicate continuePredicate = loop.continueOnTrue ? predicate : negatePredicate(predicate);
+    bool monotone = false;
+    switch (continuePredicate) {
+        case LLIRCmpPredicate::LT:
+        case LLIRCmpPredicate::LE:
+            monotone = iv->step > 0;
+            break;
+        case LLIRCmpPredicate::GT:
+        case LLIRCmpPredicate::GE:
+            monotone = iv->step < 0;
+            break;
+        default:
+            break;
+    }
+    if (!monotone) {
+        reason = "loop condition is not monotone in the induction variable";
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace core
+} // namespace cverifier
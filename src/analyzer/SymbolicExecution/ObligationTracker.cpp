@@ -0,0 +1,138 @@
+/**
+ * @file ObligationTracker.cpp
+ * @brief 检查义务跟踪实现
+ */
+
+#include "cverifier/ObligationTracker.h"
+#include <unordered_set>
+
+namespace cverifier {
+namespace core {
+
+ObligationTracker::ObligationTracker(CFG* cfg) {
+    std::vector<CFGNode*> nodes;
+    for (const auto& [id, node] : cfg->getNodes()) {
+        if (node && node->getBasicBlock()) {
+            nodes.push_back(node);
+        }
+    }
+
+    // 编号检查点
+    for (CFGNode* node : nodes) {
+        for (LLIRInstruction* inst : node->getBasicBlock()->getInstructions()) {
+            if (isCheckSite(inst)) {
+                sites_.emplace(inst, sites_.size());
+            }
+        }
+    }
+
+    const size_t words = (sites_.size() + 63) / 64;
+    reported_.assign(words, 0);
+    for (CFGNode* node : nodes) {
+        Bitset& bits = reachable_[node];
+        bits.assign(words, 0);
+        for (LLIRInstruction* inst : node->getBasicBlock()->getInstructions()) {
+            auto it = sites_.find(inst);
+            if (it != sites_.end()) {
+                bits[it->second / 64] |= uint64_t(1) << (it->second % 64);
+            }
+        }
+    }
+
+    // 向后传播到不动点：节点可达其后继可达的所有义务
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (CFGNode* node : nodes) {
+            Bitset& bits = reachable_[node];
+            for (CFGNode* succ : node->getSuccessors()) {
+                auto it = reachable_.find(succ);
+                if (it == reachable_.end()) {
+                    continue;
+                }
+                for (size_t w = 0; w < words; ++w) {
+                    uint64_t merged = bits[w] | it->second[w];
+                    if (merged != bits[w]) {
+                        bits[w] = merged;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool ObligationTracker::isCheckSite(const LLIRInstruction* inst) {
+    return inst && (inst->getType() == LLIRInstructionType::Load ||
+                    inst->getType() == LLIRInstructionType::Store);
+}
+
+bool ObligationTracker::resolve(const LLIRInstruction* inst) {
+    auto it = sites_.find(inst);
+    return it != sites_.end() && resolveIndex(it->second);
+}
+
+bool ObligationTracker::discharge(const LLIRInstruction* inst) {
+    auto it = sites_.find(inst);
+    if (it == sites_.end() || !markResolved(it->second)) {
+        return false;
+    }
+    ++numDischarged_;
+    return true;
+}
+
+bool ObligationTracker::resolveIndex(size_t index) {
+    if (!markResolved(index)) {
+        return false;
+    }
+    ++numReported_;
+    return true;
+}
+
+bool ObligationTracker::markResolved(size_t index) {
+    if (index >= sites_.size()) {
+        return false;
+    }
+
+    uint64_t& word = reported_[index / 64];
+    uint64_t bit = uint64_t(1) << (index % 64);
+    if (word & bit) {
+        return false;
+    }
+    word |= bit;
+    return true;
+}
+
+std::vector<size_t> ObligationTracker::getReportedIndices() const {
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < sites_.size(); ++i) {
+        if (reported_[i / 64] & (uint64_t(1) << (i % 64))) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+bool ObligationTracker::hasPending(const std::vector<const CFGNode*>& frontier) const {
+    std::unordered_set<const CFGNode*> seen;
+    for (const CFGNode* node : frontier) {
+        if (!seen.insert(node).second) {
+            continue;
+        }
+
+        auto it = reachable_.find(node);
+        if (it == reachable_.end()) {
+            // 不在 CFG 中的节点：保守地认为还有义务
+            return true;
+        }
+        for (size_t w = 0; w < reported_.size(); ++w) {
+            if (it->second[w] & ~reported_[w]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace core
+} // namespace cverifier
@@ -0,0 +1,192 @@
+/**
+ * @file ResourceGovernor.cpp
+ * @brief 函数级/路径级资源调度器实现
+ */
+
+#include "cverifier/ResourceGovernor.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+constexpr size_t kBytesPerMB = 1024 * 1024;
+
+/// 两次读取常驻内存之间的最小间隔（毫秒）
+constexpr double kMemorySampleIntervalMs = 10.0;
+
+/**
+ * @brief 已用量是否超过上限（上限为0表示不限）
+ */
+template<typename T>
+bool exceeds(T used, T limit) {
+    return limit > T(0) && used > limit;
+}
+
+} // anonymous namespace
+
+ResourceGovernor::ResourceGovernor(const GovernorConfig& config)
+    : config_(config) {
+    pathBudget_.wallClockMs = config_.pathTimeSec * 1000.0;
+    pathBudget_.states = config_.pathMaxSteps;
+    pathBudget_.memoryBytes = config_.pathMemoryMB * kBytesPerMB;
+    pathBudget_.solverMs = config_.pathSolverSec * 1000.0;
+}
+
+void ResourceGovernor::beginModule() {
+    moduleTimer_.reset();
+    moduleStates_ = 0;
+    moduleSolverMs_ = 0.0;
+    functionsStarted_ = 0;
+    functionsExhausted_ = 0;
+    inFunction_ = false;
+}
+
+void ResourceGovernor::beginFunction(const std::string& name, size_t remainingFunctions) {
+    if (inFunction_) {
+        endFunction();
+    }
+
+    const double shares = static_cast<double>(std::max<size_t>(remainingFunctions, 1));
+
+    // 从资源池中领取份额：之前函数未用完的预算自动计入剩余量
+    double remainingMs = config_.totalTimeSec * 1000.0 - moduleTimer_.elapsedMs();
+    functionBudget_.wallClockMs = std::max(remainingMs, 0.0) / shares;
+
+    int64_t remainingStates = config_.totalStates - moduleStates_;
+    functionBudget_.states = std::max<int64_t>(remainingStates, 0) /
+                             static_cast<int64_t>(shares);
+    // 至少保证一个状态，否则函数完全无法开始
+    functionBudget_.states = std::max<int64_t>(functionBudget_.states, 1);
+
+    // 内存在函数结束后即可回收，因此每个函数都拿到完整上限
+    functionBudget_.memoryBytes = config_.memoryLimitMB * kBytesPerMB;
+
+    if (config_.solverTimeSec > 0.0) {
+        double remainingSolverMs = config_.solverTimeSec * 1000.0 - moduleSolverMs_;
+        // 用 epsilon 避免份额为 0 时被误解释为"不限"
+        functionBudget_.solverMs = std::max(remainingSolverMs / shares, 1e-3);
+    } else {
+        functionBudget_.solverMs = 0.0;
+    }
+
+    currentFunction_ = name;
+    functionTimer_.reset();
+    functionStates_ = 0;
+    functionSolverMs_ = 0.0;
+    functionBaseMemory_ = residentMemoryBytes();
+    sampledMemory_ = functionBaseMemory_;
+    memorySampleTimer_.reset();
+    lastVerdict_ = BudgetVerdict::Ok;
+    inFunction_ = true;
+    ++functionsStarted_;
+
+    utils::Logger::debug("Budget for " + name + ": " +
+                         std::to_string(static_cast<int64_t>(functionBudget_.wallClockMs)) + "ms, " +
+                         std::to_string(functionBudget_.states) + " states");
+}
+
+void ResourceGovernor::endFunction() {
+    if (!inFunction_) {
+        return;
+    }
+
+    // 只把实际消耗计入资源池，剩余部分留给后续函数
+    moduleStates_ += functionStates_;
+    moduleSolverMs_ += functionSolverMs_;
+
+    if (lastVerdict_ != BudgetVerdict::Ok) {
+        ++functionsExhausted_;
+    }
+
+    inFunction_ = false;
+}
+
+BudgetVerdict ResourceGovernor::checkFunction() const {
+    BudgetVerdict verdict = BudgetVerdict::Ok;
+
+    if (exceeds(functionTimer_.elapsedMs(), functionBudget_.wallClockMs)) {
+        verdict = BudgetVerdict::WallClockExceeded;
+    } else if (functionBudget_.states > 0 && functionStates_ >= functionBudget_.states) {
+        verdict = BudgetVerdict::StatesExceeded;
+    } else if (exceeds(functionSolverMs_, functionBudget_.solverMs)) {
+        verdict = BudgetVerdict::SolverTimeExceeded;
+    } else if (functionBudget_.memoryBytes > 0) {
+        if (memorySampleTimer_.elapsedMs() >= kMemorySampleIntervalMs) {
+            sampledMemory_ = residentMemoryBytes();
+            memorySampleTimer_.reset();
+        }
+        size_t current = sampledMemory_;
+        if (current > functionBaseMemory_ &&
+            current - functionBaseMemory_ > functionBudget_.memoryBytes) {
+            verdict = BudgetVerdict::MemoryExceeded;
+        }
+    }
+
+    lastVerdict_ = verdict;
+    return verdict;
+}
+
+BudgetVerdict ResourceGovernor::checkPath(const PathUsage& usage) const {
+    if (exceeds(usage.wallClockMs, pathBudget_.wallClockMs)) {
+        return BudgetVerdict::WallClockExceeded;
+    }
+    if (exceeds(usage.steps, pathBudget_.states)) {
+        return BudgetVerdict::StatesExceeded;
+    }
+    if (exceeds(usage.memoryBytes, pathBudget_.memoryBytes)) {
+        return BudgetVerdict::MemoryExceeded;
+    }
+    if (exceeds(usage.solverMs, pathBudget_.solverMs)) {
+        return BudgetVerdict::SolverTimeExceeded;
+    }
+    return BudgetVerdict::Ok;
+}
+
+size_t ResourceGovernor::residentMemoryBytes() {
+#if defined(__linux__)
+    // /proc/self/statm: size resident shared text lib data dt（单位：页）
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+const char* ResourceGovernor::verdictToString(BudgetVerdict verdict) {
+    switch (verdict) {
+        case BudgetVerdict::Ok: return "ok";
+        case BudgetVerdict::WallClockExceeded: return "wall-clock";
+        case BudgetVerdict::StatesExceeded: return "states";
+        case BudgetVerdict::MemoryExceeded: return "memory";
+        case BudgetVerdict::SolverTimeExceeded: return "solver-time";
+        default: return "unknown";
+    }
+}
+
+std::string ResourceGovernor::getStatistics() const {
+    std::ostringstream oss;
+
+    oss << "Resource Governor Statistics:\n";
+    oss << "  Functions Budgeted: " << functionsStarted_ << "\n";
+    oss << "  Functions Exhausted: " << functionsExhausted_ << "\n";
+    oss << "  States Used: " << moduleStates_ + (inFunction_ ? functionStates_ : 0)
+        << " / " << config_.totalStates << "\n";
+    oss << "  Solver Time Used: " << std::fixed
+        << (moduleSolverMs_ + (inFunction_ ? functionSolverMs_ : 0.0)) << "ms\n";
+
+    return oss.str();
+}
+
+} // namespace core
+} // namespace cverifier
@@ -0,0 +1,461 @@
+/**
+ * @file SummaryStore.cpp
+ * @brief 持久化函数摘要库实现
+ */
+
+#include "cverifier/SummaryStore.h"
+#include "cverifier/LLIRValue.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+constexpr const char* kSummaryMagic = "cverifier-summary";
+constexpr int kSummaryFormatVersion = 2;
+
+/// 单个摘要中每类条件/效果的最大条目数，避免循环函数生成过大的文件
+constexpr size_t kMaxSummaryEntries = 256;
+
+/**
+ * @brief 按制表符切分（保留空字段，StringUtils::split 会丢弃空字段）
+ */
+std::vector<std::string> splitFields(const std::string& str) {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    while (true) {
+        size_t tab = str.find('\t', start);
+        if (tab == std::string::npos) {
+            fields.push_back(str.substr(start));
+            return fields;
+        }
+        fields.push_back(str.substr(start, tab - start));
+        start = tab + 1;
+    }
+}
+
+/**
+ * @brief 混入操作数：指令结果按其在函数中的序号编码，与内存地址无关
+ */
+uint64_t hashOperand(
+    const LLIRValue* value,
+    const std::unordered_map<const LLIRValue*, uint64_t>& ordinals,
+    uint64_t hash
+) {
+    using utils::HashUtils;
+
+    if (!value) {
+        return HashUtils::fnv1a(std::string("null"), hash);
+    }
+
+    auto it = ordinals.find(value);
+    if (it != ordinals.end()) {
+        hash = HashUtils::fnv1a(std::string("inst"), hash);
+        return HashUtils::fnv1a(it->second, hash);
+    }
+
+    if (auto* constant = dynamic_cast<const LLIRConstant*>(value)) {
+        hash = HashUtils::fnv1a(std::string("const"), hash);
+        hash = HashUtils::fnv1a(static_cast<uint64_t>(constant->getConstantType()), hash);
+        if (constant->isInteger()) {
+            return HashUtils::fnv1a(static_cast<uint64_t>(constant->getIntValue()), hash);
+        }
+        if (constant->isFloat()) {
+            double d = constant->getFloatValue();
+            uint64_t bits = 0;
+            std::memcpy(&bits, &d, sizeof(bits));
+            return HashUtils::fnv1a(bits, hash);
+        }
+        return hash;
+    }
+
+    if (auto* var = dynamic_cast<const LLIRVariable*>(value)) {
+        hash = HashUtils::fnv1a(std::string("var"), hash);
+        hash = HashUtils::fnv1a(var->getName(), hash);
+        hash = HashUtils::fnv1a(static_cast<uint64_t>(var->getType()), hash);
+        return HashUtils::fnv1a(static_cast<uint64_t>(var->getId()), hash);
+    }
+
+    if (auto* arg = dynamic_cast<const LLIRArgument*>(value)) {
+        hash = HashUtils::fnv1a(std::string("arg"), hash);
+        hash = HashUtils::fnv1a(arg->getName(), hash);
+        return HashUtils::fnv1a(static_cast<uint64_t>(arg->getIndex()), hash);
+    }
+
+    if (auto* global = dynamic_cast<const LLIRGlobalVariable*>(value)) {
+        hash = HashUtils::fnv1a(std::string("global"), hash);
+        return HashUtils::fnv1a(global->getName(), hash);
+    }
+
+    return HashUtils::fnv1a(value->toString(), hash);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// SummaryKey / FunctionSummary 实现
+// ============================================================================
+
+std::string SummaryKey::toString() const {
+    return utils::HashUtils::toHex(contentHash) + "-" + utils::HashUtils::toHex(configHash);
+}
+
+void FunctionSummary::addUnique(std::vector<std::string>& entries, const std::string& entry) {
+    if (entries.size() >= kMaxSummaryEntries) {
+        return;
+    }
+    if (std::find(entries.begin(), entries.end(), entry) == entries.end()) {
+        entries.push_back(entry);
+    }
+}
+
+std::string FunctionSummary::escapeField(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (char c : str) {
+        switch (c) {
+            case '\\': result += "\\\\"; break;
+            case '\t': result += "\\t"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            default: result += c; break;
+        }
+    }
+    return result;
+}
+
+std::string FunctionSummary::unescapeField(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (size_t i = 0; i < str.size(); ++i) {
+        if (str[i] == '\\' && i + 1 < str.size()) {
+            switch (str[++i]) {
+                case 't': result += '\t'; break;
+                case 'n': result += '\n'; break;
+                case 'r': result += '\r'; break;
+                default: result += str[i]; break;
+            }
+        } else {
+            result += str[i];
+        }
+    }
+    return result;
+}
+
+std::string FunctionSummary::encodeReport(const VulnerabilityReport& report) {
+    std::ostringstream oss;
+    oss << static_cast<int>(report.type) << "\t"
+        << static_cast<int>(report.severity) << "\t"
+        << escapeField(report.location.file) << "\t"
+        << report.location.line << "\t"
+        << report.location.column << "\t"
+        << escapeField(report.message) << "\t"
+        << escapeField(report.description);
+
+    // 修复建议和反例：先写条目数，反例按变量名排序使编码稳定
+    oss << "\t" << report.fixSuggestions.size();
+    for (const auto& suggestion : report.fixSuggestions) {
+        oss << "\t" << escapeField(suggestion);
+    }
+    std::map<std::string, std::string> counterExample(report.counterExample.begin(),
+                                                      report.counterExample.end());
+    oss << "\t" << counterExample.size();
+    for (const auto& [name, value] : counterExample) {
+        oss << "\t" << escapeField(name) << "\t" << escapeField(value);
+    }
+    return oss.str();
+}
+
+bool FunctionSummary::decodeReport(const std::string& line, VulnerabilityReport& report) {
+    auto fields = splitFields(line);
+    if (fields.size() < 7) {
+        return false;
+    }
+
+    try {
+        report.type = static_cast<VulnerabilityType>(std::stoi(fields[0]));
+        report.severity = static_cast<Severity>(std::stoi(fields[1]));
+        report.location.file = unescapeField(fields[2]);
+        report.location.line = std::stoi(fields[3]);
+        report.location.column = std::stoi(fields[4]);
+    } catch (const std::exception&) {
+        return false;
+    }
+    report.message = unescapeField(fields[5]);
+    report.description = unescapeField(fields[6]);
+
+    size_t next = 7;
+    try {
+        if (next < fields.size()) {
+            size_t count = std::stoul(fields[next++]);
+            if (fields.size() - next < count) {
+                return false;
+            }
+            for (size_t i = 0; i < count; ++i) {
+                report.fixSuggestions.push_back(unescapeField(fields[next++]));
+            }
+        }
+        if (next < fields.size()) {
+            size_t count = std::stoul(fields[next++]);
+            if ((fields.size() - next) / 2 < count) {
+                return false;
+            }
+            for (size_t i = 0; i < count; ++i) {
+                std::string name = unescapeField(fields[next++]);
+                report.counterExample[name] = unescapeField(fields[next++]);
+            }
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// SummaryStore 实现
+// ============================================================================
+
+SummaryStore::SummaryStore(const std::string& directory)
+    : directory_(directory), usable_(false) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    usable_ = !ec && std::filesystem::is_directory(directory_, ec);
+
+    if (!usable_) {
+        utils::Logger::warning("Summary store directory not usable: " + directory_);
+    }
+}
+
+uint64_t SummaryStore::hashFunction(const LLIRFunction* func) {
+    using utils::HashUtils;
+
+    uint64_t hash = HashUtils::fnv1a(static_cast<uint64_t>(kSummaryFormatVersion));
+    if (!func) {
+        return hash;
+    }
+
+    // 先给所有指令编号，操作数引用指令时使用编号
+    std::unordered_map<const LLIRValue*, uint64_t> ordinals;
+    uint64_t ordinal = 0;
+    for (auto* bb : func->getBasicBlocks()) {
+        for (auto* inst : bb->getInstructions()) {
+            ordinals[inst] = ordinal++;
+        }
+    }
+
+    hash = HashUtils::fnv1a(func->getName(), hash);
+    if (func->getEntryBlock()) {
+        hash = HashUtils::fnv1a(func->getEntryBlock()->getName(), hash);
+    }
+
+    for (auto* bb : func->getBasicBlocks()) {
+        hash = HashUtils::fnv1a(bb->getName(), hash);
+
+        for (auto* succ : bb->getSuccessors()) {
+            hash = HashUtils::fnv1a(succ ? succ->getName() : std::string(), hash);
+        }
+
+        for (auto* inst : bb->getInstructions()) {
+            hash = HashUtils::fnv1a(static_cast<uint64_t>(inst->getType()), hash);
+            hash = HashUtils::fnv1a(static_cast<uint64_t>(inst->getPredicate()), hash);
+
+            // 源码位置会出现在报告中，因此也属于函数内容
+            const SourceLocation loc = inst->getLocation();
+            hash = HashUtils::fnv1a(loc.file, hash);
+            hash = HashUtils::fnv1a(static_cast<uint64_t>(loc.line), hash);
+            hash = HashUtils::fnv1a(static_cast<uint64_t>(loc.column), hash);
+
+            hash = HashUtils::fnv1a(static_cast<uint64_t>(inst->getOperands().size()), hash);
+            for (auto* operand : inst->getOperands()) {
+                hash = hashOperand(operand, ordinals, hash);
+            }
+        }
+    }
+
+    return hash;
+}
+
+bool SummaryStore::lookup(const SummaryKey& key, FunctionSummary& summary) {
+    std::string id = key.toString();
+
+    auto it = cache_.find(id);
+    if (it != cache_.end()) {
+        summary = it->second;
+        ++hits_;
+        return true;
+    }
+
+    bool loaded = false;
+    if (usable_) {
+        try {
+            loaded = readFile(pathFor(key), summary);
+        } catch (const std::exception& e) {
+            // 损坏的摘要按未命中处理，重新分析后会被覆盖
+            utils::Logger::warning("Ignoring corrupt summary " + id + ": " + e.what());
+        }
+    }
+
+    if (loaded) {
+        cache_[id] = summary;
+        ++hits_;
+        return true;
+    }
+
+    ++misses_;
+    return false;
+}
+
+bool SummaryStore::store(const FunctionSummary& summary) {
+    cache_[summary.key.toString()] = summary;
+
+    if (!usable_) {
+        return false;
+    }
+
+    if (!writeFile(pathFor(summary.key), summary)) {
+        utils::Logger::warning("Failed to write summary for " + summary.function);
+        return false;
+    }
+
+    ++writes_;
+    return true;
+}
+
+std::string SummaryStore::pathFor(const SummaryKey& key) const {
+    return utils::PathUtils::join(directory_, key.toString() + ".summary");
+}
+
+bool SummaryStore::readFile(const std::string& path, FunctionSummary& summary) const {
+    std::ifstream in(path);
+    if (!in) {
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(in, line) ||
+        line != std::string(kSummaryMagic) + " " + std::to_string(kSummaryFormatVersion)) {
+        utils::Logger::warning("Ignoring summary with unknown format: " + path);
+        return false;
+    }
+
+    FunctionSummary result;
+    bool complete = false;
+
+    while (std::getline(in, line)) {
+        size_t space = line.find(' ');
+        std::string tag = line.substr(0, space);
+        std::string value = space == std::string::npos ? "" : line.substr(space + 1);
+
+        if (tag == "function") {
+            result.function = FunctionSummary::unescapeField(value);
+        } else if (tag == "key") {
+            size_t dash = value.find('-');
+            if (dash == std::string::npos) {
+                return false;
+            }
+            result.key.contentHash = std::stoull(value.substr(0, dash), nullptr, 16);
+            result.key.configHash = std::stoull(value.substr(dash + 1), nullptr, 16);
+        } else if (tag == "paths") {
+            result.exploredPaths = std::stoi(value);
+        } else if (tag == "states") {
+            result.reachedStates = std::stoull(value);
+        } else if (tag == "pre") {
+            result.preconditions.push_back(FunctionSummary::unescapeField(value));
+        } else if (tag == "post") {
+            result.postconditions.push_back(FunctionSummary::unescapeField(value));
+        } else if (tag == "heap") {
+            result.heapEffects.push_back(FunctionSummary::unescapeField(value));
+        } else if (tag == "report") {
+            VulnerabilityReport report;
+            if (!FunctionSummary::decodeReport(value, report)) {
+                return false;
+            }
+            result.reports.push_back(std::move(report));
+        } else if (tag == "end") {
+            complete = true;
+            break;
+        }
+    }
+
+    // 截断的文件（例如写入进程崩溃）不可信
+    if (!complete) {
+        return false;
+    }
+
+    summary = std::move(result);
+    return true;
+}
+
+bool SummaryStore::writeFile(const std::string& path, const FunctionSummary& summary) const {
+    // 临时文件名带进程号，避免并发写入同一摘要时互相覆盖
+#if defined(__unix__) || defined(__APPLE__)
+    std::string tmpPath = path + ".tmp." + std::to_string(getpid());
+#else
+    std::string tmpPath = path + ".tmp";
+#endif
+
+    {
+        std::ofstream out(tmpPath, std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+
+        out << kSummaryMagic << " " << kSummaryFormatVersion << "\n";
+        out << "function " << FunctionSummary::escapeField(summary.function) << "\n";
+        out << "key " << summary.key.toString() << "\n";
+        out << "paths " << summary.exploredPaths << "\n";
+        out << "states " << summary.reachedStates << "\n";
+
+        for (const auto& pre : summary.preconditions) {
+            out << "pre " << FunctionSummary::escapeField(pre) << "\n";
+        }
+        for (const auto& post : summary.postconditions) {
+            out << "post " << FunctionSummary::escapeField(post) << "\n";
+        }
+        for (const auto& heap : summary.heapEffects) {
+            out << "heap " << FunctionSummary::escapeField(heap) << "\n";
+        }
+        for (const auto& report : summary.reports) {
+            out << "report " << FunctionSummary::encodeReport(report) << "\n";
+        }
+
+        out << "end\n";
+        if (!out) {
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::string SummaryStore::getStatistics() const {
+    std::ostringstream oss;
+
+    oss << "Summary Store Statistics:\n";
+    oss << "  Directory: " << directory_ << "\n";
+    oss << "  Hits: " << hits_ << "\n";
+    oss << "  Misses: " << misses_ << "\n";
+    oss << "  Written: " << writes_ << "\n";
+
+    return oss.str();
+}
+
+} // namespace core
+} // namespace cverifier
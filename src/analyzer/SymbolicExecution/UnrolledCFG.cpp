@@ -0,0 +1,111 @@
+/**
+ * @file UnrolledCFG.cpp
+ * @brief 有界展开的控制流图实现
+ */
+
+#include "cverifier/UnrolledCFG.h"
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <unordered_map>
+
+namespace cverifier {
+namespace core {
+
+UnrolledCFG::UnrolledCFG(CFG* cfg, int bound, CFGNode* start) {
+    CFGNode* entry = cfg->getEntryNode();
+    if (!entry) {
+        return;
+    }
+    if (!start) {
+        start = entry;
+    }
+
+    std::set<std::pair<const CFGNode*, const CFGNode*>> backEdges;
+    for (const auto& edge : cfg->findBackEdges()) {
+        backEdges.insert(edge);
+    }
+    auto isBackEdge = [&](const CFGNode* from, const CFGNode* to) {
+        return backEdges.count({from, to}) != 0;
+    };
+
+    // 去掉回边后的逆后序即拓扑序
+    std::vector<CFGNode*> order;
+    std::unordered_map<const CFGNode*, bool> visited;
+    std::function<void(CFGNode*)> dfs = [&](CFGNode* node) {
+        visited[node] = true;
+        for (auto* succ : node->getSuccessors()) {
+            if (!isBackEdge(node, succ) && !visited[succ]) {
+                dfs(succ);
+            }
+        }
+        order.push_back(node);
+    };
+    dfs(entry);
+    std::reverse(order.begin(), order.end());
+
+    std::unordered_map<const CFGNode*, size_t> position;
+    for (size_t i = 0; i < order.size(); ++i) {
+        position[order[i]] = i;
+    }
+
+    // pending[层][逆后序位置]：已知的前驱，非空时实例可达
+    const size_t layers = static_cast<size_t>(std::max(bound, 0)) + 1;
+    std::vector<std::vector<std::vector<std::pair<size_t, size_t>>>> pending(
+        layers, std::vector<std::vector<std::pair<size_t, size_t>>>(order.size()));
+
+    for (size_t layer = 0; layer < layers; ++layer) {
+        for (size_t pos = 0; pos < order.size(); ++pos) {
+            CFGNode* node = order[pos];
+            bool isStart = layer == 0 && node == start;
+            if (!isStart && pending[layer][pos].empty()) {
+                continue;
+            }
+
+            size_t index = blocks_.size();
+            blocks_.push_back({node, static_cast<int>(layer), std::move(pending[layer][pos])});
+
+            const auto& successors = node->getSuccessors();
+            for (size_t s = 0; s < successors.size(); ++s) {
+                auto it = position.find(successors[s]);
+                if (it == position.end()) {
+                    continue;
+                }
+                if (!isBackEdge(node, successors[s])) {
+                    pending[layer][it->second].emplace_back(index, s);
+                } else if (layer + 1 < layers) {
+                    pending[layer + 1][it->second].emplace_back(index, s);
+                } else {
+                    ++numTruncated_;
+                }
+            }
+        }
+    }
+}
+
+VariableExpr* UnrolledEncoding::define(const std::string& name, Expr* value) {
+    if (isBooleanExpr(value)) {
+        value = new IteExpr(value, new ConstantExpr(1), new ConstantExpr(0));
+    }
+    auto* var = new VariableExpr(name + "@" + std::to_string(definitions.size()));
+    definitions.push_back(new BinaryOpExpr(BinaryOpType::EQ, var, value));
+    return var;
+}
+
+Expr* UnrolledEncoding::anyReached(const std::vector<size_t>& instances) const {
+    if (instances.empty()) {
+        return new BinaryOpExpr(BinaryOpType::NE, new ConstantExpr(0), new ConstantExpr(0));
+    }
+
+    Expr* any = nullptr;
+    for (size_t b : instances) {
+        if (!blocks[b].guard) {
+            return nullptr;
+        }
+        any = any ? new BinaryOpExpr(BinaryOpType::LOr, any, blocks[b].guard) : blocks[b].guard;
+    }
+    return any;
+}
+
+} // namespace core
+} // namespace cverifier
@@ -4,6 +4,7 @@
  */
 
 #include "cverifier/CFG.h"
+#include "cverifier/LLIRValue.h"
 #include <algorithm>
 #include <queue>
 #include <stack>
@@ -46,8 +47,23 @@ void CFG::build() {
             LLIRInstructionType type = lastInst->getType();
 
             if (type == LLIRInstructionType::Br) {
+                // 分支目标记录在操作数中（基本块名称）；条件分支依次为 then、else
+                bool linked = false;
+                for (auto* operand : lastInst->getOperands()) {
+                    auto* target = dynamic_cast<LLIRVariable*>(operand);
+                    if (!target || target->getType() != ValueType::Void) {
+                        continue;
+                    }
+                    auto it = nodes_.find(target->getName());
+                    if (it != nodes_.end()) {
+                        node->addSuccessor(it->second);
+                        it->second->addPredecessor(node);
+                        linked = true;
+                    }
+                }
+
                 // 无条件分支：唯一的后继
-                if (!bb->getSuccessors().empty()) {
+                if (!linked && !bb->getSuccessors().empty()) {
                     auto* succBB = bb->getSuccessors()[0];
                     if (succBB) {
                         auto* succNode = nodes_[succBB->getName()];
@@ -220,30 +236,24 @@ std::vector<CFGNode*> CFG::getDominanceFrontier(CFGNode* node) const {
 std::vector<std::pair<CFGNode*, CFGNode*>> CFG::findBackEdges() const {
     std::vector<std::pair<CFGNode*, CFGNode*>> backEdges;
 
-    // 使用DFS检测回边：从当前节点到其祖先节点的边
-    std::unordered_map<CFGNode*, int> discoveryTime;
-    std::unordered_map<CFGNode*, int> lowTime;
+    // 使用DFS检测回边：指向DFS栈上祖先节点的边
     std::unordered_set<CFGNode*> visited;
-    int time = 0;
+    std::unordered_set<CFGNode*> onStack;
 
     std::function<void(CFGNode*)> dfs = [&](CFGNode* node) {
-        discoveryTime[node] = lowTime[node] = time++;
         visited.insert(node);
+        onStack.insert(node);
 
         for (auto* succ : node->getSuccessors()) {
-            if (!visited.count(succ)) {
+            if (onStack.count(succ)) {
+                // node -> succ 是回边（node 为回边源，succ 为循环头）
+                backEdges.push_back({node, succ});
+            } else if (!visited.count(succ)) {
                 dfs(succ);
-                lowTime[node] = std::min(lowTime[node], lowTime[succ]);
-
-                // 检查是否是回边
-                if (lowTime[succ] >= discoveryTime[node]) {
-                    // succ到node的边是回边
-                    backEdges.push_back({succ, node});
-                }
-            } else {
-                lowTime[node] = std::min(lowTime[node], discoveryTime[succ]);
             }
         }
+
+        onStack.erase(node);
     };
 
     if (entryNode_) {
@@ -306,9 +316,9 @@ std::vector<std::vector<CFGNode*>> CFG::findLoops() const {
     auto backEdges = findBackEdges();
 
     for (auto [source, target] : backEdges) {
-        // 找到从target到source的所有节点，形成一个自然循环
-        std::vector<CFGNode*> loopNodes;
-        std::unordered_set<CFGNode*> inLoop;
+        // 自然循环：循环头加上不经过循环头就能到达回边源的所有节点
+        std::vector<CFGNode*> loopNodes{target};
+        std::unordered_set<CFGNode*> inLoop{target};
 
         std::function<void(CFGNode*)> collect = [&](CFGNode* node) {
             if (inLoop.count(node)) return;
@@ -316,13 +326,11 @@ std::vector<std::vector<CFGNode*>> CFG::findLoops() const {
             loopNodes.push_back(node);
 
             for (auto* pred : node->getPredecessors()) {
-                if (pred != target && hasPath(pred, source)) {
-                    collect(pred);
-                }
+                collect(pred);
             }
         };
 
-        collect(target);
+        collect(source);
         loops.push_back(loopNodes);
     }
 
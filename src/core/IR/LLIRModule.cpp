@@ -90,6 +90,17 @@ std::string LLIRInstruction::toString() const {
             break;
     }
 
+    // 比较谓词
+    switch (predicate_) {
+        case LLIRCmpPredicate::EQ: oss << " eq"; break;
+        case LLIRCmpPredicate::NE: oss << " ne"; break;
+        case LLIRCmpPredicate::LT: oss << " lt"; break;
+        case LLIRCmpPredicate::LE: oss << " le"; break;
+        case LLIRCmpPredicate::GT: oss << " gt"; break;
+        case LLIRCmpPredicate::GE: oss << " ge"; break;
+        default: break;
+    }
+
     // 操作数
     for (size_t i = 0; i < operands_.size(); ++i) {
         if (i > 0) {
@@ -0,0 +1,373 @@
+/**
+ * @file ExprCodec.cpp
+ * @brief 表达式二进制编码与区域分配实现
+ */
+
+#include "cverifier/ExprCodec.h"
+#include <algorithm>
+#include <cstring>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+void writeVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/**
+ * @brief 顺序读取编码结果，越界时置失败标记并返回 0
+ */
+class ByteReader {
+public:
+    explicit ByteReader(const std::string& data) : data_(data) {}
+
+    bool ok() const { return ok_; }
+    bool atEnd() const { return pos_ == data_.size(); }
+    size_t remaining() const { return data_.size() - pos_; }
+    size_t position() const { return pos_; }
+
+    uint8_t byte() {
+        if (pos_ >= data_.size()) {
+            ok_ = false;
+            return 0;
+        }
+        return static_cast<uint8_t>(data_[pos_++]);
+    }
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = byte();
+            if (!ok_) {
+                return 0;
+            }
+            value |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                return value;
+            }
+        }
+        ok_ = false;
+        return 0;
+    }
+
+    bool skip(size_t length) {
+        if (length > remaining()) {
+            ok_ = false;
+            return false;
+        }
+        pos_ += length;
+        return true;
+    }
+
+private:
+    const std::string& data_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+/// 符号名在编码结果中的位置
+struct SymbolRef {
+    size_t offset;
+    size_t length;
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// ExprArena 实现
+// ============================================================================
+
+ExprArena::~ExprArena() {
+    for (auto it = exprs_.rbegin(); it != exprs_.rend(); ++it) {
+        (*it)->~Expr();
+    }
+}
+
+void* ExprArena::allocate(size_t size, size_t align) {
+    auto aligned = [align](unsigned char* ptr) {
+        auto address = reinterpret_cast<uintptr_t>(ptr);
+        return (address + align - 1) & ~static_cast<uintptr_t>(align - 1);
+    };
+
+    if (!next_ || aligned(next_) + size > reinterpret_cast<uintptr_t>(end_)) {
+        // 超过块大小的请求单独占一块
+        size_t blockSize = std::max(kBlockSize, size + align);
+        blocks_.emplace_back(new unsigned char[blockSize]);
+        next_ = blocks_.back().get();
+        end_ = next_ + blockSize;
+    }
+
+    uintptr_t address = aligned(next_);
+    next_ = reinterpret_cast<unsigned char*>(address + size);
+    bytesUsed_ += size;
+    return reinterpret_cast<void*>(address);
+}
+
+// ============================================================================
+// ExprEncoder 实现
+// ============================================================================
+
+bool ExprEncoder::add(const Expr* root) {
+    lastError_.clear();
+
+    // 显式栈的后序遍历：表达式深度不受调用栈限制
+    std::vector<std::pair<const Expr*, bool>> stack{{root, false}};
+    while (!stack.empty()) {
+        auto& [expr, expanded] = stack.back();
+        if (!expr) {
+            return fail("null expression");
+        }
+        if (nodeIndex_.count(expr)) {
+            stack.pop_back();
+            continue;
+        }
+        if (expanded) {
+            const Expr* done = expr;
+            stack.pop_back();
+            writeNode(done);
+            continue;
+        }
+        expanded = true;
+
+        // 逆序入栈，左侧子表达式先写入
+        const Expr* current = expr;
+        switch (current->getType()) {
+            case ExprType::Constant:
+            case ExprType::Variable:
+                break;
+            case ExprType::BinaryOp: {
+                auto* binary = static_cast<const BinaryOpExpr*>(current);
+                stack.emplace_back(binary->getRight(), false);
+                stack.emplace_back(binary->getLeft(), false);
+                break;
+            }
+            case ExprType::UnaryOp:
+                stack.emplace_back(static_cast<const UnaryOpExpr*>(current)->getOperand(), false);
+                break;
+            case ExprType::Ite: {
+                auto* ite = static_cast<const IteExpr*>(current);
+                stack.emplace_back(ite->getElse(), false);
+                stack.emplace_back(ite->getThen(), false);
+                stack.emplace_back(ite->getCondition(), false);
+                break;
+            }
+            default:
+                // 解码端没有对应的表达式类；在写入前拒绝，已写入的子节点仍是合法节点
+                return fail("unsupported expression type " +
+                            std::to_string(static_cast<int>(current->getType())));
+        }
+    }
+
+    roots_.push_back(nodeIndex_.at(root));
+    return true;
+}
+
+bool ExprEncoder::fail(const std::string& message) {
+    lastError_ = message;
+    return false;
+}
+
+uint64_t ExprEncoder::symbolIndex(const std::string& name) {
+    auto [it, inserted] = symbolIndex_.emplace(name, symbols_.size());
+    if (inserted) {
+        symbols_.push_back(&it->first);
+    }
+    return it->second;
+}
+
+void ExprEncoder::writeNode(const Expr* expr) {
+    uint64_t index = numNodes_++;
+    nodeIndex_[expr] = index;
+    auto operand = [&](const Expr* child) {
+        writeVarint(nodes_, index - nodeIndex_.at(child));
+    };
+
+    nodes_.push_back(static_cast<char>(expr->getType()));
+    switch (expr->getType()) {
+        case ExprType::Constant:
+            writeVarint(nodes_, zigzag(static_cast<const ConstantExpr*>(expr)->getValue()));
+            break;
+        case ExprType::Variable:
+            writeVarint(nodes_, symbolIndex(static_cast<const VariableExpr*>(expr)->getName()));
+            break;
+        case ExprType::BinaryOp: {
+            auto* binary = static_cast<const BinaryOpExpr*>(expr);
+            nodes_.push_back(static_cast<char>(binary->getOp()));
+            operand(binary->getLeft());
+            operand(binary->getRight());
+            break;
+        }
+        case ExprType::UnaryOp: {
+            auto* unary = static_cast<const UnaryOpExpr*>(expr);
+            nodes_.push_back(static_cast<char>(unary->getOp()));
+            operand(unary->getOperand());
+            break;
+        }
+        case ExprType::Ite: {
+            auto* ite = static_cast<const IteExpr*>(expr);
+            operand(ite->getCondition());
+            operand(ite->getThen());
+            operand(ite->getElse());
+            break;
+        }
+        default:
+            // add() 展开时已拒绝
+            break;
+    }
+}
+
+std::string ExprEncoder::finish() const {
+    std::string out(kMagic, sizeof(kMagic));
+    writeVarint(out, kVersion);
+
+    writeVarint(out, symbols_.size());
+    for (const std::string* name : symbols_) {
+        writeVarint(out, name->size());
+        out += *name;
+    }
+
+    writeVarint(out, numNodes_);
+    out += nodes_;
+
+    writeVarint(out, roots_.size());
+    for (uint64_t root : roots_) {
+        writeVarint(out, root);
+    }
+    return out;
+}
+
+// ============================================================================
+// ExprDecoder 实现
+// ============================================================================
+
+bool ExprDecoder::decode(const std::string& data, std::vector<Expr*>& roots) {
+    roots.clear();
+    lastError_.clear();
+
+    if (data.size() < sizeof(ExprEncoder::kMagic) ||
+        std::memcmp(data.data(), ExprEncoder::kMagic, sizeof(ExprEncoder::kMagic)) != 0) {
+        return fail("not an encoded expression graph");
+    }
+    ByteReader in(data);
+    in.skip(sizeof(ExprEncoder::kMagic));
+    uint64_t version = in.varint();
+    if (!in.ok() || version != ExprEncoder::kVersion) {
+        return fail("unsupported version " + std::to_string(version));
+    }
+
+    // 每个条目至少占一个字节，计数大于剩余字节数的输入必然截断
+    uint64_t numSymbols = in.varint();
+    if (!in.ok() || numSymbols > in.remaining()) {
+        return fail("bad symbol count");
+    }
+    auto* symbols = static_cast<SymbolRef*>(
+        arena_.allocate(numSymbols * sizeof(SymbolRef), alignof(SymbolRef)));
+    for (uint64_t i = 0; i < numSymbols; ++i) {
+        uint64_t length = in.varint();
+        symbols[i] = {in.position(), static_cast<size_t>(length)};
+        if (!in.ok() || length > in.remaining() || !in.skip(static_cast<size_t>(length))) {
+            return fail("truncated symbol table");
+        }
+    }
+
+    uint64_t numNodes = in.varint();
+    if (!in.ok() || numNodes > in.remaining()) {
+        return fail("bad node count");
+    }
+    auto* nodes = static_cast<Expr**>(arena_.allocate(numNodes * sizeof(Expr*), alignof(Expr*)));
+    for (uint64_t i = 0; i < numNodes; ++i) {
+        // 子节点序号差在 [1, i] 内，保证引用的是已解码的节点
+        auto operand = [&]() -> Expr* {
+            uint64_t delta = in.varint();
+            return in.ok() && delta >= 1 && delta <= i ? nodes[i - delta] : nullptr;
+        };
+
+        Expr* expr = nullptr;
+        switch (static_cast<ExprType>(in.byte())) {
+            case ExprType::Constant:
+                expr = arena_.create<ConstantExpr>(unzigzag(in.varint()));
+                break;
+            case ExprType::Variable: {
+                uint64_t symbol = in.varint();
+                if (in.ok() && symbol < numSymbols) {
+                    expr = arena_.create<VariableExpr>(
+                        data.substr(symbols[symbol].offset, symbols[symbol].length));
+                }
+                break;
+            }
+            case ExprType::BinaryOp: {
+                uint8_t op = in.byte();
+                Expr* left = operand();
+                Expr* right = operand();
+                if (op <= static_cast<uint8_t>(BinaryOpType::LOr) && left && right) {
+                    expr = arena_.create<BinaryOpExpr>(static_cast<BinaryOpType>(op), left, right);
+                }
+                break;
+            }
+            case ExprType::UnaryOp: {
+                uint8_t op = in.byte();
+                Expr* child = operand();
+                if (op <= static_cast<uint8_t>(UnaryOpType::LNot) && child) {
+                    expr = arena_.create<UnaryOpExpr>(static_cast<UnaryOpType>(op), child);
+                }
+                break;
+            }
+            case ExprType::Ite: {
+                Expr* cond = operand();
+                Expr* thenExpr = operand();
+                Expr* elseExpr = operand();
+                if (cond && thenExpr && elseExpr) {
+                    expr = arena_.create<IteExpr>(cond, thenExpr, elseExpr);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        if (!in.ok() || !expr) {
+            return fail("malformed node " + std::to_string(i));
+        }
+        nodes[i] = expr;
+    }
+
+    uint64_t numRoots = in.varint();
+    if (!in.ok() || numRoots > in.remaining()) {
+        return fail("bad root count");
+    }
+    roots.reserve(static_cast<size_t>(numRoots));
+    for (uint64_t i = 0; i < numRoots; ++i) {
+        uint64_t root = in.varint();
+        if (!in.ok() || root >= numNodes) {
+            roots.clear();
+            return fail("bad root " + std::to_string(i));
+        }
+        roots.push_back(nodes[root]);
+    }
+    if (!in.atEnd()) {
+        roots.clear();
+        return fail("trailing bytes after expression graph");
+    }
+    return true;
+}
+
+bool ExprDecoder::fail(const std::string& message) {
+    lastError_ = message;
+    return false;
+}
+
+} // namespace core
+} // namespace cverifier
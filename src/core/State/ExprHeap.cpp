@@ -0,0 +1,209 @@
+/**
+ * @file ExprHeap.cpp
+ * @brief 表达式回收实现
+ */
+
+#include "cverifier/ExprHeap.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <set>
+
+namespace cverifier {
+namespace core {
+
+namespace {
+
+struct EpochRegistry {
+    std::mutex mutex;
+    uint64_t current = 1;
+    std::multiset<uint64_t> pinned;
+};
+
+EpochRegistry& registry() {
+    // 不析构：静态对象析构之后仍可能有钉住被释放
+    static EpochRegistry* instance = new EpochRegistry();
+    return *instance;
+}
+
+ExprHeap*& currentHeap() {
+    thread_local ExprHeap* heap = nullptr;
+    return heap;
+}
+
+void destroy(Expr* expr) {
+    expr->~Expr();
+    ::operator delete(static_cast<void*>(expr));
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// ExprEpoch 实现
+// ============================================================================
+
+ExprEpoch::Pin& ExprEpoch::Pin::operator=(Pin&& other) noexcept {
+    if (this != &other) {
+        release();
+        epoch_ = other.epoch_;
+        active_ = other.active_;
+        other.active_ = false;
+    }
+    return *this;
+}
+
+void ExprEpoch::Pin::release() {
+    if (!active_) {
+        return;
+    }
+    active_ = false;
+    EpochRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.pinned.erase(reg.pinned.find(epoch_));
+}
+
+ExprEpoch::Pin ExprEpoch::pin() {
+    EpochRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.pinned.insert(reg.current);
+    return Pin(reg.current);
+}
+
+uint64_t ExprEpoch::advance() {
+    EpochRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return reg.current++;
+}
+
+uint64_t ExprEpoch::oldestPinned() {
+    EpochRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return reg.pinned.empty() ? std::numeric_limits<uint64_t>::max() : *reg.pinned.begin();
+}
+
+// ============================================================================
+// ExprHeap 实现
+// ============================================================================
+
+ExprHeap::Scope::Scope(ExprHeap* heap) : previous_(currentHeap()) {
+    currentHeap() = heap;
+}
+
+ExprHeap::Scope::~Scope() {
+    currentHeap() = previous_;
+}
+
+ExprHeap::~ExprHeap() {
+    reclaim();
+}
+
+void* ExprHeap::allocate(size_t size) {
+    void* ptr = ::operator new(size);
+    if (ExprHeap* heap = currentHeap()) {
+        heap->objects_.push_back(static_cast<Expr*>(ptr));
+    }
+    return ptr;
+}
+
+void ExprHeap::deallocate(void* ptr) noexcept {
+    ExprHeap* heap = currentHeap();
+    if (heap && !heap->objects_.empty() && heap->objects_.back() == ptr) {
+        heap->objects_.pop_back();
+    }
+    ::operator delete(ptr);
+}
+
+bool ExprHeap::shouldCollect() const {
+    return objects_.size() >= std::max(kMinCollectObjects, 2 * liveAfterCollection_);
+}
+
+void ExprHeap::beginCollection() {
+    // 轮次在进程内全局递增：未接入的表达式可能被多个堆标记过，旧标记不会与新一轮相同。
+    // 新建的表达式轮次为 0，不会被误认为已标记
+    static std::atomic<uint32_t> rounds{0};
+    do {
+        round_ = rounds.fetch_add(1, std::memory_order_relaxed) + 1;
+    } while (round_ == 0);
+}
+
+void ExprHeap::mark(const Expr* root) {
+    if (!root || root->mark_ == round_) {
+        return;
+    }
+    root->mark_ = round_;
+    markStack_.push_back(root);
+
+    // 共享的子表达式只展开一次
+    auto push = [this](const Expr* child) {
+        if (child && child->mark_ != round_) {
+            child->mark_ = round_;
+            markStack_.push_back(child);
+        }
+    };
+    while (!markStack_.empty()) {
+        const Expr* expr = markStack_.back();
+        markStack_.pop_back();
+        switch (expr->getType()) {
+            case ExprType::BinaryOp: {
+                auto* binary = static_cast<const BinaryOpExpr*>(expr);
+                push(binary->getLeft());
+                push(binary->getRight());
+                break;
+            }
+            case ExprType::UnaryOp:
+                push(static_cast<const UnaryOpExpr*>(expr)->getOperand());
+                break;
+            case ExprType::Ite: {
+                auto* ite = static_cast<const IteExpr*>(expr);
+                push(ite->getCondition());
+                push(ite->getThen());
+                push(ite->getElse());
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+size_t ExprHeap::sweep() {
+    RetiredBatch batch;
+    auto live = std::partition(objects_.begin(), objects_.end(),
+                               [this](const Expr* expr) { return expr->mark_ == round_; });
+    batch.exprs.assign(live, objects_.end());
+    objects_.erase(live, objects_.end());
+    liveAfterCollection_ = objects_.size();
+    ++collections_;
+
+    // 纪元在登记之后推进：此后钉住的读者只能拿到仍可达的表达式
+    batch.epoch = ExprEpoch::advance();
+    size_t count = batch.exprs.size();
+    if (count > 0) {
+        retiredCount_ += count;
+        retired_.push_back(std::move(batch));
+    }
+    return count;
+}
+
+size_t ExprHeap::reclaim() {
+    if (retired_.empty()) {
+        return 0;
+    }
+    uint64_t oldest = ExprEpoch::oldestPinned();
+    size_t count = 0;
+    while (!retired_.empty() && retired_.front().epoch < oldest) {
+        for (Expr* expr : retired_.front().exprs) {
+            destroy(expr);
+        }
+        count += retired_.front().exprs.size();
+        retired_.pop_front();
+    }
+    retiredCount_ -= count;
+    freed_ += count;
+    return count;
+}
+
+} // namespace core
+} // namespace cverifier
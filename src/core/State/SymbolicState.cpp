@@ -4,19 +4,53 @@
  */
 
 #include "cverifier/SymbolicState.h"
+#include "cverifier/ExprHeap.h"
 #include "cverifier/Utils.h"
 #include <sstream>
 #include <algorithm>
 
+using cverifier::utils::HashUtils;
 using cverifier::utils::Logger;
 
 namespace cverifier {
 namespace core {
 
+namespace {
+
+/**
+ * @brief 64 位终结混合（splitmix64），让按异或/求和聚合的元素哈希各位均匀
+ */
+uint64_t finalizeHash(uint64_t hash) {
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+} // anonymous namespace
+
 // ============================================================================
 // Expr 实现
 // ============================================================================
 
+uint64_t Expr::combine(uint64_t seed, uint64_t value) {
+    return HashUtils::fnv1a(value, seed);
+}
+
+uint64_t Expr::hashName(const std::string& name) {
+    return HashUtils::fnv1a(name);
+}
+
+void* Expr::operator new(size_t size) {
+    return ExprHeap::allocate(size);
+}
+
+void Expr::operator delete(void* ptr) noexcept {
+    ExprHeap::deallocate(ptr);
+}
+
 std::string ConstantExpr::toString() const {
     return std::to_string(value_);
 }
@@ -67,12 +101,110 @@ std::string UnaryOpExpr::toString() const {
     return opStr + operand_->toString();
 }
 
+bool isBooleanExpr(const Expr* expr) {
+    if (expr->getType() == ExprType::UnaryOp) {
+        return static_cast<const UnaryOpExpr*>(expr)->getOp() == UnaryOpType::LNot;
+    }
+    if (expr->getType() != ExprType::BinaryOp) {
+        return false;
+    }
+    switch (static_cast<const BinaryOpExpr*>(expr)->getOp()) {
+        case BinaryOpType::EQ: case BinaryOpType::NE:
+        case BinaryOpType::LT: case BinaryOpType::GT:
+        case BinaryOpType::LE: case BinaryOpType::GE:
+        case BinaryOpType::LAnd: case BinaryOpType::LOr:
+            return true;
+        default:
+            return false;
+    }
+}
+
+namespace {
+
+Expr* substituteMemo(
+    Expr* expr,
+    const std::unordered_map<std::string, Expr*>& bindings,
+    std::unordered_map<const Expr*, Expr*>& memo
+) {
+    auto it = memo.find(expr);
+    if (it != memo.end()) {
+        return it->second;
+    }
+
+    Expr* result = expr;
+    switch (expr->getType()) {
+        case ExprType::Variable: {
+            auto bound = bindings.find(static_cast<VariableExpr*>(expr)->getName());
+            if (bound != bindings.end()) {
+                // 变量是整数，布尔值按 0/1 代入
+                result = isBooleanExpr(bound->second)
+                    ? new IteExpr(bound->second, new ConstantExpr(1), new ConstantExpr(0))
+                    : bound->second;
+            }
+            break;
+        }
+        case ExprType::BinaryOp: {
+            auto* binary = static_cast<BinaryOpExpr*>(expr);
+            Expr* left = substituteMemo(binary->getLeft(), bindings, memo);
+            Expr* right = substituteMemo(binary->getRight(), bindings, memo);
+            if (left != binary->getLeft() || right != binary->getRight()) {
+                result = new BinaryOpExpr(binary->getOp(), left, right);
+            }
+            break;
+        }
+        case ExprType::UnaryOp: {
+            auto* unary = static_cast<UnaryOpExpr*>(expr);
+            Expr* operand = substituteMemo(unary->getOperand(), bindings, memo);
+            if (operand != unary->getOperand()) {
+                result = new UnaryOpExpr(unary->getOp(), operand);
+            }
+            break;
+        }
+        case ExprType::Ite: {
+            auto* ite = static_cast<IteExpr*>(expr);
+            Expr* cond = substituteMemo(ite->getCondition(), bindings, memo);
+            Expr* thenExpr = substituteMemo(ite->getThen(), bindings, memo);
+            Expr* elseExpr = substituteMemo(ite->getElse(), bindings, memo);
+            if (cond != ite->getCondition() || thenExpr != ite->getThen() ||
+                elseExpr != ite->getElse()) {
+                result = new IteExpr(cond, thenExpr, elseExpr);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    memo[expr] = result;
+    return result;
+}
+
+} // anonymous namespace
+
+Expr* substituteVariables(Expr* expr, const std::unordered_map<std::string, Expr*>& bindings) {
+    if (!expr || bindings.empty()) {
+        return expr;
+    }
+    std::unordered_map<const Expr*, Expr*> memo;
+    return substituteMemo(expr, bindings, memo);
+}
+
+std::string IteExpr::toString() const {
+    return "(" + cond_->toString() + " ? " + then_->toString() + " : " + else_->toString() + ")";
+}
+
 // ============================================================================
 // SymbolicStore 实现
 // ============================================================================
 
+uint64_t SymbolicStore::bindingHash(const std::string& var, const Expr* expr) {
+    return expr ? finalizeHash(HashUtils::fnv1a(expr->hash(), HashUtils::fnv1a(var))) : 0;
+}
+
 std::unique_ptr<SymbolicStore> SymbolicStore::clone() const {
     auto newStore = std::make_unique<SymbolicStore>();
+    // 深拷贝的表达式结构不变，指纹相同
+    newStore->fingerprint_ = fingerprint_;
     for (const auto& [var, expr] : store_) {
         // 深拷贝表达式对象
         if (expr) {
@@ -102,12 +234,26 @@ std::unique_ptr<SymbolicStore> SymbolicStore::clone() const {
     return newStore;
 }
 
+size_t SymbolicStore::removeIf(const std::function<bool(const std::string&)>& predicate) {
+    size_t removed = 0;
+    for (auto it = store_.begin(); it != store_.end();) {
+        if (predicate(it->first)) {
+            fingerprint_ ^= bindingHash(it->first, it->second);
+            it = store_.erase(it);
+            ++removed;
+        } else {
+            ++it;
+        }
+    }
+    return removed;
+}
+
 void SymbolicStore::merge(const SymbolicStore& other) {
     // 简化的合并策略：如果两个存储中同一个变量有不同的值，
     // 则保留当前存储的值（更精确的合并需要使用格理论）
     for (const auto& [var, expr] : other.store_) {
         if (store_.find(var) == store_.end()) {
-            store_[var] = expr;
+            bind(var, expr);
         }
     }
 }
@@ -135,10 +281,37 @@ std::string SymbolicStore::toString() const {
 // SymbolicHeap 实现
 // ============================================================================
 
+uint64_t SymbolicHeap::objectHash(const HeapObject& obj) {
+    uint64_t hash = HashUtils::fnv1a(obj.address->hash());
+    hash = HashUtils::fnv1a(obj.size ? obj.size->hash() : 0, hash);
+    return finalizeHash(HashUtils::fnv1a(static_cast<uint64_t>(obj.isFreed), hash));
+}
+
+SymbolicHeap::SymbolicHeap(const SymbolicHeap& other) {
+    *this = other;
+}
+
+SymbolicHeap& SymbolicHeap::operator=(const SymbolicHeap& other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    objects_.clear();
+    bases_.clear();
+    objects_.reserve(other.objects_.size());
+    for (const auto& obj : other.objects_) {
+        objects_.push_back(std::make_unique<HeapObject>(*obj));
+        bases_[static_cast<VariableExpr*>(obj->address)->getName()] = objects_.back().get();
+    }
+    nextBase_ = other.nextBase_;
+    fingerprint_ = other.fingerprint_;
+    return *this;
+}
+
 Expr* SymbolicHeap::allocate(Expr* size, const SourceLocation& loc) {
-    // 创建一个新的符号地址
-    static int allocId = 0;
-    std::string addrName = "heap_" + std::to_string(allocId++);
+    // 创建一个新的符号地址：按本堆中的分配序号命名，克隆出的状态继续编号，
+    // 同一路径上的名字唯一，且与其他路径和运行次序无关
+    std::string addrName = "heap_" + std::to_string(objects_.size());
 
     auto* obj = new HeapObject();
     obj->address = new VariableExpr(addrName);
@@ -146,17 +319,36 @@ Expr* SymbolicHeap::allocate(Expr* size, const SourceLocation& loc) {
     obj->allocSite = loc;
     obj->isFreed = false;
 
+    // 区域按分配顺序递增，objects_ 因此按地址有序
+    auto* constSize = dynamic_cast<ConstantExpr*>(size);
+    obj->base = nextBase_;
+    obj->extent = constSize ? static_cast<uint64_t>(std::max<int64_t>(constSize->getValue(), 0))
+                            : kSymbolicExtent;
+    constexpr uint64_t kAlign = 16;
+    nextBase_ = (obj->base + obj->extent + kAlign - 1) / kAlign * kAlign + kRedZone;
+
     objects_.push_back(std::unique_ptr<HeapObject>(obj));
-    addressMap_[obj->address] = obj;
+    bases_[addrName] = obj;
+    fingerprint_ += objectHash(*obj);
 
     return obj->address;
 }
 
 void SymbolicHeap::free(Expr* address) {
-    auto it = addressMap_.find(address);
-    if (it != addressMap_.end()) {
-        it->second->isFreed = true;
-        addressMap_.erase(it);
+    int64_t constant = 0;
+    bool symbolic = false;
+    const HeapObject* object = decompose(address, constant, symbolic);
+    if (symbolic) {
+        return;
+    }
+
+    uint64_t addr = (object ? object->base : 0) + static_cast<uint64_t>(constant);
+    const HeapObject* hit = findObject(addr);
+    if (hit && hit->base == addr && !hit->isFreed) {
+        auto* obj = const_cast<HeapObject*>(hit);
+        fingerprint_ -= objectHash(*obj);
+        obj->isFreed = true;
+        fingerprint_ += objectHash(*obj);
     }
 }
 
@@ -173,12 +365,124 @@ void SymbolicHeap::store(Expr* address, Expr* value, Expr* offset) {
 }
 
 bool SymbolicHeap::mayBeNull(Expr* address) const {
-    // 简化实现：检查地址是否可能是NULL
-    // 实际实现中需要使用符号执行来分析
-    if (auto* constExpr = dynamic_cast<ConstantExpr*>(address)) {
-        return constExpr->getValue() == 0;
+    // 对象地址加常量偏移不为空；含其他符号的地址可能为空
+    int64_t constant = 0;
+    bool symbolic = false;
+    const HeapObject* object = decompose(address, constant, symbolic);
+    if (symbolic) {
+        return true;
+    }
+    return (object ? object->base : 0) + static_cast<uint64_t>(constant) == 0;
+}
+
+const HeapObject* SymbolicHeap::decompose(Expr* pointer, int64_t& constant, bool& symbolic) const {
+    constant = 0;
+    symbolic = false;
+    const HeapObject* object = nullptr;
+    uint64_t sum = 0;
+
+    // 沿加减法展开，每一项带符号；只有正号的对象地址作为基址
+    std::vector<std::pair<Expr*, bool>> pending = {{pointer, false}};
+    while (!pending.empty()) {
+        auto [expr, negated] = pending.back();
+        pending.pop_back();
+        if (!expr) {
+            symbolic = true;
+            continue;
+        }
+
+        if (auto* constExpr = dynamic_cast<ConstantExpr*>(expr)) {
+            auto value = static_cast<uint64_t>(constExpr->getValue());
+            sum = negated ? sum - value : sum + value;
+            continue;
+        }
+        if (auto* binary = dynamic_cast<BinaryOpExpr*>(expr)) {
+            if (binary->getOp() == BinaryOpType::Add || binary->getOp() == BinaryOpType::Sub) {
+                pending.push_back({binary->getLeft(), negated});
+                pending.push_back({binary->getRight(),
+                                   binary->getOp() == BinaryOpType::Sub ? !negated : negated});
+                continue;
+            }
+        }
+        if (auto* var = dynamic_cast<VariableExpr*>(expr)) {
+            auto it = bases_.find(var->getName());
+            if (it != bases_.end() && !negated && !object) {
+                object = it->second;
+                continue;
+            }
+        }
+        symbolic = true;
+    }
+
+    constant = static_cast<int64_t>(sum);
+    return object;
+}
+
+namespace {
+
+/// addr + offset，超出地址空间时截断到两端
+uint64_t offsetAddress(uint64_t addr, int64_t offset) {
+    if (offset >= 0) {
+        auto delta = static_cast<uint64_t>(offset);
+        return delta > std::numeric_limits<uint64_t>::max() - addr
+            ? std::numeric_limits<uint64_t>::max() : addr + delta;
+    }
+    uint64_t delta = 0 - static_cast<uint64_t>(offset);
+    return delta > addr ? 0 : addr - delta;
+}
+
+} // anonymous namespace
+
+std::vector<const HeapObject*> SymbolicHeap::resolve(Expr* pointer, int64_t minOffset, int64_t maxOffset) const {
+    int64_t constant = 0;
+    bool symbolic = false;
+    const HeapObject* object = decompose(pointer, constant, symbolic);
+    uint64_t addr = (object ? object->base : 0) + static_cast<uint64_t>(constant);
+
+    if (!symbolic) {
+        const HeapObject* hit = findObject(addr);
+        return hit ? std::vector<const HeapObject*>{hit} : std::vector<const HeapObject*>{};
     }
-    return true;  // 非常量地址，可能为NULL
+    if (minOffset > maxOffset) {
+        return {};
+    }
+    // 其余部分的范围默认不受限，结果是所有对象
+    return findObjects(offsetAddress(addr, minOffset), offsetAddress(addr, maxOffset));
+}
+
+const HeapObject* SymbolicHeap::findObject(uint64_t addr) const {
+    // 最后一个起始地址不大于 addr 的对象
+    auto it = std::upper_bound(objects_.begin(), objects_.end(), addr,
+                               [](uint64_t value, const std::unique_ptr<HeapObject>& obj) {
+                                   return value < obj->base;
+                               });
+    if (it == objects_.begin()) {
+        return nullptr;
+    }
+    const HeapObject* obj = std::prev(it)->get();
+    return obj->contains(addr) ? obj : nullptr;
+}
+
+std::vector<const HeapObject*> SymbolicHeap::findObjects(uint64_t lo, uint64_t hi) const {
+    std::vector<const HeapObject*> result;
+    if (lo > hi) {
+        return result;
+    }
+
+    // 区域互不重叠且按地址有序：从包含 lo 的对象（或 lo 之后的第一个）开始
+    auto it = std::upper_bound(objects_.begin(), objects_.end(), lo,
+                               [](uint64_t value, const std::unique_ptr<HeapObject>& obj) {
+                                   return value < obj->base;
+                               });
+    if (it != objects_.begin() && std::prev(it)->get()->contains(lo)) {
+        --it;
+    }
+    for (; it != objects_.end() && (*it)->base <= hi; ++it) {
+        if ((*it)->extent > 0) {
+            result.push_back(it->get());
+        }
+    }
+    return result;
 }
 
 std::vector<const HeapObject*> SymbolicHeap::getUnfreedObjects() const {
@@ -191,6 +495,17 @@ std::vector<const HeapObject*> SymbolicHeap::getUnfreedObjects() const {
     return result;
 }
 
+void SymbolicHeap::forEachExpr(const std::function<void(const Expr*)>& visit) const {
+    for (const auto& obj : objects_) {
+        if (obj->address) {
+            visit(obj->address);
+        }
+        if (obj->size) {
+            visit(obj->size);
+        }
+    }
+}
+
 std::string SymbolicHeap::toString() const {
     std::ostringstream oss;
     oss << "Heap[\n";
@@ -213,6 +528,21 @@ std::string SymbolicHeap::toString() const {
 // isSatisfiable() 的实现已移至 src/analyzer/SymbolicExecution/PathConstraintSolver.cpp
 // 因为它依赖于 Z3Solver，需要放在 analyzer 库中避免循环依赖
 
+uint64_t PathConstraint::constraintHash(const Expr* constraint) {
+    return finalizeHash(constraint->hash());
+}
+
+void PathConstraint::add(Expr* constraint) {
+    if (body_.use_count() > 1) {
+        body_ = std::make_shared<Body>(*body_);
+    }
+    // 约束按集合计入指纹：结构相同的约束已经在列表中时只追加，不重复计入
+    body_->constraints.push_back(constraint);
+    if (body_->seen.insert(constraint->hash()).second) {
+        fingerprint_ += constraintHash(constraint);
+    }
+}
+
 void PathConstraint::simplify() {
     // 简化约束
     // 实际实现中需要使用各种简化规则
@@ -222,9 +552,10 @@ void PathConstraint::simplify() {
 std::string PathConstraint::toString() const {
     std::ostringstream oss;
     oss << "[\n";
-    for (size_t i = 0; i < constraints_.size(); ++i) {
-        oss << "  " << constraints_[i]->toString();
-        if (i < constraints_.size() - 1) {
+    const auto& constraints = body_->constraints;
+    for (size_t i = 0; i < constraints.size(); ++i) {
+        oss << "  " << constraints[i]->toString();
+        if (i < constraints.size() - 1) {
             oss << " &&";
         }
         oss << "\n";
@@ -240,12 +571,11 @@ std::string PathConstraint::toString() const {
 std::unique_ptr<SymbolicState> SymbolicState::clone() const {
     auto newState = std::make_unique<SymbolicState>();
 
-    // 克隆存储
-    newState->store_ = *store_.clone();
+    // 克隆存储：表达式不可变，直接共享，只复制绑定表
+    newState->store_ = store_;
 
-    // 克隆堆（简化实现：深拷贝堆对象）
-    // TODO: 实现完整的堆对象深拷贝
-    // 目前跳过堆拷贝，功能不受影响
+    // 克隆堆：对象逐个复制，释放标记在分叉后各自独立
+    newState->heap_ = heap_;
 
     // 路径约束不克隆，因为每个路径的约束应该独立
     // 新状态从空约束开始
@@ -273,6 +603,38 @@ void SymbolicState::addConstraint(Expr* constraint) {
     pathConstraint_.add(constraint);
 }
 
+size_t SymbolicState::estimateMemoryUsage() const {
+    // 粗略估算：绑定按哈希表节点计，约束按指针+表达式节点计
+    constexpr size_t kBindingBytes = 64;
+    constexpr size_t kConstraintBytes = 48;
+
+    return sizeof(SymbolicState) +
+           store_.size() * kBindingBytes +
+           pathConstraint_.getConstraints().size() * kConstraintBytes +
+           heap_.size() * sizeof(HeapObject);
+}
+
+uint64_t SymbolicState::getFingerprint() const {
+    uint64_t hash = HashUtils::fnv1a(store_.getFingerprint());
+    hash = HashUtils::fnv1a(heap_.getFingerprint(), hash);
+    return HashUtils::fnv1a(pathConstraint_.getFingerprint(), hash);
+}
+
+void SymbolicState::forEachExpr(const std::function<void(const Expr*)>& visit) const {
+    for (const auto& [name, expr] : store_.getBindings()) {
+        if (expr) {
+            visit(expr);
+        }
+    }
+    heap_.forEachExpr(visit);
+    for (const Expr* constraint : pathConstraint_.getConstraints()) {
+        visit(constraint);
+    }
+    if (parent_) {
+        parent_->forEachExpr(visit);
+    }
+}
+
 std::string SymbolicState::toString() const {
     std::ostringstream oss;
 
@@ -487,17 +487,17 @@ LLIRValue* ASTToLLIRConverter::convertBinaryOperator(clang::BinaryOperator* binO
         case clang::BO_Rem:
             return core::LLIRFactory::createRem(left, right);
         case clang::BO_EQ:
-            return core::LLIRFactory::createICmp(left, right);
+            return core::LLIRFactory::createICmp(left, right, LLIRCmpPredicate::EQ);
         case clang::BO_NE:
-            return core::LLIRFactory::createICmp(left, right);
+            return core::LLIRFactory::createICmp(left, right, LLIRCmpPredicate::NE);
         case clang::BO_LT:
-            return core::LLIRFactory::createICmp(left, right);
+            return core::LLIRFactory::createICmp(left, right, LLIRCmpPredicate::LT);
         case clang::BO_GT:
-            return core::LLIRFactory::createICmp(left, right);
+            return core::LLIRFactory::createICmp(left, right, LLIRCmpPredicate::GT);
         case clang::BO_LE:
-            return core::LLIRFactory::createICmp(left, right);
+            return core::LLIRFactory::createICmp(left, right, LLIRCmpPredicate::LE);
         case clang::BO_GE:
-            return core::LLIRFactory::createICmp(left, right);
+            return core::LLIRFactory::createICmp(left, right, LLIRCmpPredicate::GE);
         case clang::BO_LAnd:
             return core::LLIRFactory::createAnd(left, right);
         case clang::BO_LOr:
@@ -0,0 +1,326 @@
+/**
+ * @file SarifExporter.cpp
+ * @brief SARIF 报告导出实现
+ */
+
+#include "cverifier/SarifExporter.h"
+#include "cverifier/Utils.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace cverifier {
+namespace report {
+
+namespace {
+
+constexpr const char* kSarifSchema =
+    "https://json.schemastore.org/sarif-2.1.0.json";
+
+/**
+ * @brief 规则元数据
+ */
+struct RuleInfo {
+    VulnerabilityType type;
+    const char* id;
+    const char* name;
+    const char* description;
+};
+
+const RuleInfo kRules[] = {
+    {VulnerabilityType::BufferOverflow, "buffer-overflow", "BufferOverflow", "Buffer Overflow"},
+    {VulnerabilityType::NullPointerDereference, "null-pointer-dereference",
+     "NullPointerDereference", "Null Pointer Dereference"},
+    {VulnerabilityType::MemoryLeak, "memory-leak", "MemoryLeak", "Memory Leak"},
+    {VulnerabilityType::IntegerOverflow, "integer-overflow", "IntegerOverflow", "Integer Overflow"},
+    {VulnerabilityType::FloatOverflow, "float-overflow", "FloatOverflow", "Float Overflow"},
+    {VulnerabilityType::DivisionByZero, "division-by-zero", "DivisionByZero", "Division By Zero"},
+    {VulnerabilityType::UseAfterFree, "use-after-free", "UseAfterFree", "Use After Free"},
+    {VulnerabilityType::DoubleFree, "double-free", "DoubleFree", "Double Free"},
+    {VulnerabilityType::UninitializedVariable, "uninitialized-variable",
+     "UninitializedVariable", "Uninitialized Variable"},
+    {VulnerabilityType::DeadCode, "dead-code", "DeadCode", "Dead Code"},
+    {VulnerabilityType::Unknown, "unknown", "Unknown", "Unknown"},
+};
+
+const RuleInfo& ruleInfo(VulnerabilityType type) {
+    for (const auto& rule : kRules) {
+        if (rule.type == type) {
+            return rule;
+        }
+    }
+    return kRules[sizeof(kRules) / sizeof(kRules[0]) - 1];
+}
+
+const char* severityName(Severity severity) {
+    switch (severity) {
+        case Severity::Info: return "INFO";
+        case Severity::Low: return "LOW";
+        case Severity::Medium: return "MEDIUM";
+        case Severity::High: return "HIGH";
+        case Severity::Critical: return "CRITICAL";
+        default: return "UNKNOWN";
+    }
+}
+
+const char* sarifLevel(Severity severity) {
+    switch (severity) {
+        case Severity::Critical:
+        case Severity::High:
+            return "error";
+        case Severity::Medium:
+            return "warning";
+        default:
+            return "note";
+    }
+}
+
+/**
+ * @brief 反例按变量名排序后的文本（unordered_map 的遍历顺序不稳定）
+ */
+std::string counterExampleKey(const VulnerabilityReport& report) {
+    std::map<std::string, std::string> sorted(report.counterExample.begin(),
+                                              report.counterExample.end());
+    std::string key;
+    for (const auto& [name, value] : sorted) {
+        key += name + "=" + value + ";";
+    }
+    return key;
+}
+
+std::string traceKey(const VulnerabilityReport& report) {
+    std::string key;
+    for (const auto& loc : report.trace) {
+        key += loc.toString() + ";";
+    }
+    return key;
+}
+
+/**
+ * @brief 两个报告是否是同一个发现（只有出现次数、反例和轨迹不同）
+ */
+bool sameFinding(const VulnerabilityReport& a, const VulnerabilityReport& b) {
+    return a.location.file == b.location.file && a.location.line == b.location.line &&
+           a.location.column == b.location.column && a.type == b.type &&
+           a.severity == b.severity && a.message == b.message && a.description == b.description;
+}
+
+std::string physicalLocation(const SourceLocation& loc) {
+    std::ostringstream oss;
+    oss << "{\"physicalLocation\": {\"artifactLocation\": {\"uri\": " << utils::StringUtils::jsonString(loc.file)
+        << "}, \"region\": {\"startLine\": " << loc.line;
+    if (loc.column > 0) {
+        oss << ", \"startColumn\": " << loc.column;
+    }
+    oss << "}}}";
+    return oss.str();
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// SarifExporter 实现
+// ============================================================================
+
+const char* SarifExporter::ruleId(VulnerabilityType type) {
+    return ruleInfo(type).id;
+}
+
+bool SarifExporter::canonicalLess(const VulnerabilityReport& a, const VulnerabilityReport& b) {
+    if (a.location.file != b.location.file) {
+        return a.location.file < b.location.file;
+    }
+    if (a.location.line != b.location.line) {
+        return a.location.line < b.location.line;
+    }
+    if (a.location.column != b.location.column) {
+        return a.location.column < b.location.column;
+    }
+
+    int rule = std::string(ruleId(a.type)).compare(ruleId(b.type));
+    if (rule != 0) {
+        return rule < 0;
+    }
+
+    // 严重程度高的在前
+    if (a.severity != b.severity) {
+        return static_cast<int>(a.severity) > static_cast<int>(b.severity);
+    }
+    if (a.message != b.message) {
+        return a.message < b.message;
+    }
+    if (a.description != b.description) {
+        return a.description < b.description;
+    }
+
+    std::string ceA = counterExampleKey(a);
+    std::string ceB = counterExampleKey(b);
+    if (ceA != ceB) {
+        return ceA < ceB;
+    }
+    return traceKey(a) < traceKey(b);
+}
+
+bool SarifExporter::exportToFile(const AnalysisResult& result, const std::string& filename) const {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        utils::Logger::error("Cannot write SARIF report: " + filename);
+        return false;
+    }
+
+    out << buildSarifLog(result.reports);
+    out.close();
+    if (!out) {
+        utils::Logger::error("Failed to write SARIF report: " + filename);
+        return false;
+    }
+
+    utils::Logger::info("SARIF report written to " + filename);
+    return true;
+}
+
+std::string SarifExporter::buildSarifLog(const std::vector<VulnerabilityReport>& reports) const {
+    std::vector<const VulnerabilityReport*> sorted;
+    sorted.reserve(reports.size());
+    for (const auto& report : reports) {
+        sorted.push_back(&report);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const VulnerabilityReport* a, const VulnerabilityReport* b) {
+                         return canonicalLess(*a, *b);
+                     });
+
+    // 同一个发现在多条路径上被重复报告：保留规范顺序中的第一条
+    std::vector<std::pair<const VulnerabilityReport*, size_t>> findings;
+    for (const auto* report : sorted) {
+        if (!findings.empty() && sameFinding(*findings.back().first, *report)) {
+            findings.back().second++;
+        } else {
+            findings.emplace_back(report, 1);
+        }
+    }
+
+    // 只列出出现过的规则，按规则 ID 排序
+    std::vector<std::string> rules;
+    for (const auto& [report, count] : findings) {
+        rules.push_back(ruleId(report->type));
+    }
+    std::sort(rules.begin(), rules.end());
+    rules.erase(std::unique(rules.begin(), rules.end()), rules.end());
+
+    std::ostringstream oss;
+    oss << "{\n";
+    oss << "  \"$schema\": " << utils::StringUtils::jsonString(kSarifSchema) << ",\n";
+    oss << "  \"version\": \"2.1.0\",\n";
+    oss << "  \"runs\": [\n";
+    oss << "    {\n";
+    oss << "      \"tool\": {\n";
+    oss << "        \"driver\": {\n";
+    oss << "          \"name\": \"CVerifier\",\n";
+    oss << "          \"version\": " << utils::StringUtils::jsonString(Version::toString()) << ",\n";
+    oss << "          \"rules\": [";
+    for (size_t i = 0; i < rules.size(); ++i) {
+        const RuleInfo* info = nullptr;
+        for (const auto& rule : kRules) {
+            if (rules[i] == rule.id) {
+                info = &rule;
+            }
+        }
+        oss << (i > 0 ? ",\n" : "\n");
+        oss << "            {\"id\": " << utils::StringUtils::jsonString(info->id)
+            << ", \"name\": " << utils::StringUtils::jsonString(info->name)
+            << ", \"shortDescription\": {\"text\": " << utils::StringUtils::jsonString(info->description) << "}}";
+    }
+    oss << (rules.empty() ? "]\n" : "\n          ]\n");
+    oss << "        }\n";
+    oss << "      },\n";
+    oss << "      \"results\": [";
+    for (size_t i = 0; i < findings.size(); ++i) {
+        const VulnerabilityReport& report = *findings[i].first;
+        size_t ruleIndex = std::lower_bound(rules.begin(), rules.end(),
+                                            std::string(ruleId(report.type))) - rules.begin();
+        oss << (i > 0 ? ",\n" : "\n");
+        oss << "        " << buildResult(report, ruleIndex, findings[i].second);
+    }
+    oss << (findings.empty() ? "]\n" : "\n      ]\n");
+    oss << "    }\n";
+    oss << "  ]\n";
+    oss << "}\n";
+
+    return oss.str();
+}
+
+std::string SarifExporter::buildResult(
+    const VulnerabilityReport& report,
+    size_t ruleIndex,
+    size_t occurrences
+) const {
+    const SourceLocation& loc = report.location;
+
+    // 指纹只取决于发现本身，供 CI 跨版本跟踪同一个问题
+    uint64_t hash = utils::HashUtils::fnv1a(std::string(ruleId(report.type)));
+    hash = utils::HashUtils::fnv1a(loc.file, hash);
+    hash = utils::HashUtils::fnv1a(static_cast<uint64_t>(loc.line), hash);
+    hash = utils::HashUtils::fnv1a(static_cast<uint64_t>(loc.column), hash);
+    hash = utils::HashUtils::fnv1a(report.message, hash);
+
+    std::ostringstream oss;
+    oss << "{\"ruleId\": " << utils::StringUtils::jsonString(ruleId(report.type))
+        << ", \"ruleIndex\": " << ruleIndex
+        << ", \"level\": \"" << sarifLevel(report.severity) << "\""
+        << ", \"message\": {\"text\": " << utils::StringUtils::jsonString(report.message) << "}";
+
+    oss << ", \"locations\": [";
+    if (loc.isValid()) {
+        oss << physicalLocation(loc);
+    }
+    oss << "]";
+
+    oss << ", \"partialFingerprints\": {\"cverifier/v1\": "
+        << utils::StringUtils::jsonString(utils::HashUtils::toHex(hash)) << "}";
+
+    std::vector<const SourceLocation*> steps;
+    for (const auto& step : report.trace) {
+        if (step.isValid()) {
+            steps.push_back(&step);
+        }
+    }
+    if (!steps.empty()) {
+        oss << ", \"codeFlows\": [{\"threadFlows\": [{\"locations\": [";
+        for (size_t i = 0; i < steps.size(); ++i) {
+            oss << (i > 0 ? ", " : "") << "{\"location\": " << physicalLocation(*steps[i]) << "}";
+        }
+        oss << "]}]}]";
+    }
+
+    oss << ", \"properties\": {\"severity\": \"" << severityName(report.severity) << "\""
+        << ", \"occurrences\": " << occurrences;
+    if (!report.description.empty()) {
+        oss << ", \"description\": " << utils::StringUtils::jsonString(report.description);
+    }
+    if (!report.counterExample.empty()) {
+        std::map<std::string, std::string> sorted(report.counterExample.begin(),
+                                                  report.counterExample.end());
+        oss << ", \"counterExample\": {";
+        bool first = true;
+        for (const auto& [name, value] : sorted) {
+            oss << (first ? "" : ", ") << utils::StringUtils::jsonString(name) << ": " << utils::StringUtils::jsonString(value);
+            first = false;
+        }
+        oss << "}";
+    }
+    if (!report.fixSuggestions.empty()) {
+        oss << ", \"fixSuggestions\": [";
+        for (size_t i = 0; i < report.fixSuggestions.size(); ++i) {
+            oss << (i > 0 ? ", " : "") << utils::StringUtils::jsonString(report.fixSuggestions[i]);
+        }
+        oss << "]";
+    }
+    oss << "}}";
+
+    return oss.str();
+}
+
+} // namespace report
+} // namespace cverifier
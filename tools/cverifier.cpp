@@ -8,12 +8,14 @@
 #include "cverifier/LLIRModule.h"
 #include "cverifier/LLIRFactory.h"
 #include "cverifier/CFG.h"
+#include "cverifier/SarifExporter.h"
 #include "cverifier/Utils.h"
 
 #ifdef HAVE_LLVM
 #include "cverifier/LibClangParser.h"
 #endif
 
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 
@@ -42,10 +44,29 @@ void printUsage(const char* programName) {
     std::cout << "  --timeout <秒>          设置超时时间（默认：300秒）\n";
     std::cout << "  --max-depth <深度>      设置最大探索深度（默认：100）\n";
     std::cout << "  --max-states <数量>     设置最大状态数（默认：10000）\n";
-    std::cout << "  --strategy <策略>       路径探索策略：dfs, bfs, hybrid（默认：hybrid）\n";
+    std::cout << "  --path-memory <MB>      单路径状态估算大小上限，超出时丢弃该路径（默认：0，不限）\n";
+    std::cout << "  --path-solver-time <秒> 单路径求解器时间上限，超出时丢弃该路径（默认：0，不限）\n";
+    std::cout << "  --strategy <策略>       路径探索策略：dfs, bfs, hybrid, random, coverage, bandit（默认：dfs）\n";
     std::cout << "  --enable-abstract       启用抽象解释加速分析\n";
     std::cout << "  --domain <域>           抽象域类型：constant, interval（默认：interval）\n";
     std::cout << "  --threads <数量>        并行分析线程数（默认：4，0表示禁用）\n";
+    std::cout << "  --summary-dir <目录>    函数摘要库目录，未变化的函数复用上次的结果\n";
+    std::cout << "  --fork-workers <数量>   fork 模式子进程数，子树在独立进程中探索（默认：0）\n";
+    std::cout << "  --deterministic         确定性模式：只用逻辑步数预算，相同输入得到逐字节相同的报告\n";
+    std::cout << "  --goal-termination      所有检查点都有结论后提前结束函数（只需要结论时使用）\n";
+    std::cout << "  --bmc <k>               有界模型检查：循环最多展开 k 次，每个函数求解一个公式\n";
+    std::cout << "  --k-induction <k>       探索前用 k 归纳证明不可达的检查点（配合 --goal-termination）\n";
+    std::cout << "  --lazy-abstraction      惰性抽象：抽象可达树 + 插值细化，证明循环中不可达的检查点\n";
+    std::cout << "  --hybrid-fuzzing        混合模糊测试：变异执行，覆盖停滞时用求解器越过分支\n";
+    std::cout << "  --fuzz-plateau <次数>   连续多少次执行没有新覆盖时交给求解器（默认：256）\n";
+    std::cout << "  --no-state-dedup        不丢弃同一程序点上指纹相同的重复状态\n";
+    std::cout << "  --max-expr-size <数量>  绑定的表达式节点数上限，超出时具体化或抽象（默认：4096）\n";
+    std::cout << "  --max-expr-depth <深度> 绑定的表达式深度上限（默认：256，0表示不限）\n";
+    std::cout << "  --expr-budget-policy <方式> 表达式超出上限时：concretize, abstract（默认：concretize）\n";
+    std::cout << "  --no-lazy-fork          分叉前不判定后继可行性，每个后继都复制状态\n";
+    std::cout << "  --reclaim-exprs         回收不再被任何状态引用的表达式\n";
+    std::cout << "  --retain-states         保留执行过的状态（默认不保留：分支的最后一个可行后继沿用当前状态，\n";
+    std::cout << "                          配合 --reclaim-exprs 内存不随路径数增长；保留时每个后继都复制状态）\n";
     std::cout << "\n";
     std::cout << "=============================================================================\n";
     std::cout << "漏洞检测器:\n";
@@ -256,7 +277,12 @@ void runDemoAnalysis() {
 /**
  * @brief 分析 C 源文件
  */
-void analyzeCFile(const std::string& filename) {
+void analyzeCFile(
+    const std::string& filename,
+    const SymbolicExecutionConfig& baseConfig,
+    const std::string& format,
+    const std::string& outputFile
+) {
     utils::Logger::info("Analyzing C file: " + filename);
 
 #ifdef HAVE_LLVM
@@ -275,38 +301,55 @@ void analyzeCFile(const std::string& filename) {
     std::cout << "\nModule: " << module->getName() << "\n";
     std::cout << "Functions: " << module->getFunctions().size() << "\n";
 
-    // 分析每个函数
-    for (auto* func : module->getFunctions()) {
-        std::cout << "\n============================================================\n";
-        std::cout << "Function: " << func->getName() << "\n";
-        std::cout << "============================================================\n";
+    AnalysisResult result;
+    result.success = true;
+    result.functionsAnalyzed = 0;
+    result.pathsExplored = 0;
+    result.vulnerabilitiesFound = 0;
+    result.analysisTime = 0.0;
+    utils::Timer timer;
 
-        // 创建CFG
+    // 打印每个函数的 CFG 规模
+    for (auto* func : module->getFunctions()) {
         CFG cfg(func);
-        std::cout << "CFG Nodes: " << cfg.getNodes().size() << "\n";
-
-        // 创建符号执行配置
-        SymbolicExecutionConfig config;
-        config.maxDepth = 100;
-        config.maxStates = 1000;
-        config.timeout = 60;
-        config.verbose = utils::Logger::getLevel() >= utils::Logger::Level::Debug;
-
-        // 运行符号执行
-        std::cout << "\nRunning symbolic execution...\n";
-        SymbolicExecutionEngine engine(module, config);
-        engine.runOnFunction(func->getName());
-
-        // 打印统计信息
-        std::cout << "\n" << engine.getStatistics() << "\n";
-
-        // 打印发现的漏洞
-        int vulns = engine.getFoundVulnerabilities();
-        if (vulns > 0) {
-            std::cout << "⚠️  Found " << vulns << " potential vulnerabilit"
-                      << (vulns > 1 ? "ies" : "y") << "!\n";
+        std::cout << "Function: " << func->getName()
+                  << " (CFG Nodes: " << cfg.getNodes().size() << ")\n";
+    }
+
+    SymbolicExecutionConfig config = baseConfig;
+    config.verbose = utils::Logger::getLevel() == utils::Logger::Level::Debug;
+
+    // 整个模块共用一个引擎：函数从共同的资源池领取预算，提前结束的函数
+    // 把剩余预算留给后面的函数，预算耗尽的函数最后用剩余预算继续
+    std::cout << "\nRunning symbolic execution...\n";
+    SymbolicExecutionEngine engine(module, config);
+    engine.run();
+
+    // 打印统计信息
+    std::cout << "\n" << engine.getStatistics() << "\n";
+
+    // 打印发现的漏洞
+    int vulns = engine.getFoundVulnerabilities();
+    if (vulns > 0) {
+        std::cout << "⚠️  Found " << vulns << " potential vulnerabilit"
+                  << (vulns > 1 ? "ies" : "y") << "!\n";
+    } else {
+        std::cout << "✅ No vulnerabilities detected\n";
+    }
+
+    result.functionsAnalyzed = static_cast<int>(module->getFunctions().size());
+    result.pathsExplored = engine.getExploredPaths();
+    result.vulnerabilitiesFound = vulns;
+    result.reports = engine.getReports();
+
+    result.analysisTime = timer.elapsedSec();
+
+    if (format == "sarif") {
+        report::SarifExporter exporter;
+        if (outputFile.empty()) {
+            std::cout << exporter.buildSarifLog(result.reports);
         } else {
-            std::cout << "✅ No vulnerabilities detected\n";
+            exporter.exportToFile(result, outputFile);
         }
     }
 
@@ -315,6 +358,9 @@ void analyzeCFile(const std::string& filename) {
 
     utils::Logger::info("Analysis completed");
 #else
+    (void)baseConfig;
+    (void)format;
+    (void)outputFile;
     utils::Logger::error("LLVM/Clang not available. Cannot parse C files.");
     utils::Logger::info("Please install LLVM to enable C file analysis.");
 #endif
@@ -333,6 +379,9 @@ int main(int argc, char* argv[]) {
     std::string inputFile;
     bool verbose = false;
     bool runDemo = false;
+    SymbolicExecutionConfig config;
+    std::string format = "console";
+    std::string outputFile;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -347,6 +396,81 @@ int main(int argc, char* argv[]) {
             verbose = true;
         } else if (arg == "--demo") {
             runDemo = true;
+        } else if (arg == "--timeout" && i + 1 < argc) {
+            config.timeout = std::atoi(argv[++i]);
+        } else if (arg == "--max-depth" && i + 1 < argc) {
+            config.maxDepth = std::atoi(argv[++i]);
+        } else if (arg == "--max-states" && i + 1 < argc) {
+            config.maxStates = std::atoi(argv[++i]);
+        } else if (arg == "--summary-dir" && i + 1 < argc) {
+            config.summaryDir = argv[++i];
+        } else if (arg == "--path-memory" && i + 1 < argc) {
+            config.memoryPerPathMB = std::atoi(argv[++i]);
+        } else if (arg == "--path-solver-time" && i + 1 < argc) {
+            config.solverTimePerPath = std::atoi(argv[++i]);
+        } else if (arg == "--fork-workers" && i + 1 < argc) {
+            config.forkWorkers = std::atoi(argv[++i]);
+        } else if (arg == "--deterministic") {
+            config.deterministic = true;
+        } else if (arg == "--goal-termination") {
+            config.enableGoalTermination = true;
+        } else if (arg == "--bmc" && i + 1 < argc) {
+            config.bmcBound = std::atoi(argv[++i]);
+        } else if (arg == "--k-induction" && i + 1 < argc) {
+            config.kInduction = std::atoi(argv[++i]);
+        } else if (arg == "--lazy-abstraction") {
+            config.enableLazyAbstraction = true;
+        } else if (arg == "--hybrid-fuzzing") {
+            config.enableHybridFuzzing = true;
+        } else if (arg == "--fuzz-plateau" && i + 1 < argc) {
+            config.fuzzPlateau = std::atoi(argv[++i]);
+        } else if (arg == "--no-state-dedup") {
+            config.enableStateDeduplication = false;
+        } else if (arg == "--max-expr-size" && i + 1 < argc) {
+            config.maxExprSize = std::atoi(argv[++i]);
+        } else if (arg == "--max-expr-depth" && i + 1 < argc) {
+            config.maxExprDepth = std::atoi(argv[++i]);
+        } else if (arg == "--expr-budget-policy" && i + 1 < argc) {
+            std::string policy = argv[++i];
+            if (policy == "concretize") {
+                config.exprBudgetPolicy = ExprBudgetPolicy::Concretize;
+            } else if (policy == "abstract") {
+                config.exprBudgetPolicy = ExprBudgetPolicy::Abstract;
+            } else {
+                utils::Logger::error("Unknown expression budget policy: " + policy);
+                return 1;
+            }
+        } else if (arg == "--no-lazy-fork") {
+            config.enableLazyFork = false;
+        } else if (arg == "--reclaim-exprs") {
+            config.enableExprReclamation = true;
+        } else if (arg == "--retain-states") {
+            config.retainReachedStates = true;
+        } else if (arg == "--no-retain-states") {
+            // 已是默认值，保留以兼容旧的命令行
+            config.retainReachedStates = false;
+        } else if (arg == "--strategy" && i + 1 < argc) {
+            std::string strategy = argv[++i];
+            if (strategy == "dfs") {
+                config.strategy = ExplorationStrategy::DFS;
+            } else if (strategy == "bfs") {
+                config.strategy = ExplorationStrategy::BFS;
+            } else if (strategy == "hybrid") {
+                config.strategy = ExplorationStrategy::Hybrid;
+            } else if (strategy == "random") {
+                config.strategy = ExplorationStrategy::Random;
+            } else if (strategy == "coverage") {
+                config.strategy = ExplorationStrategy::Coverage;
+            } else if (strategy == "bandit") {
+                config.strategy = ExplorationStrategy::Bandit;
+            } else {
+                utils::Logger::error("Unknown strategy: " + strategy);
+                return 1;
+            }
+        } else if (arg == "--format" && i + 1 < argc) {
+            format = argv[++i];
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputFile = argv[++i];
         } else if (arg[0] != '-') {
             inputFile = arg;
         }
@@ -376,7 +500,7 @@ int main(int argc, char* argv[]) {
         // 检查文件扩展名
         if (inputFile.size() >= 2 && inputFile.substr(inputFile.size() - 2) == ".c") {
             // C源文件 - 使用libclang解析
-            analyzeCFile(inputFile);
+            analyzeCFile(inputFile, config, format, outputFile);
         } else {
             utils::Logger::warning("Unsupported file type");
             utils::Logger::info("Currently only .c files are supported");
@@ -0,0 +1,185 @@
+/**
+ * @file test_deterministic.cpp
+ * @brief 确定性探索模式测试程序
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/LLIRFactory.h"
+#include "cverifier/SarifExporter.h"
+#include "cverifier/Utils.h"
+#include <iostream>
+
+using namespace cverifier;
+using namespace cverifier::core;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << what << std::endl;
+    if (!condition) {
+        ++failures;
+    }
+}
+
+SourceLocation at(int line, int column) {
+    SourceLocation loc;
+    loc.file = "wide.c";
+    loc.line = line;
+    loc.column = column;
+    return loc;
+}
+
+/**
+ * @brief 连续 8 个分支的函数
+ *
+ * 第 i 个分支交替判断 a < 3i 与 b_i < i（前者彼此相关，产生不可行路径）；
+ * then 分支写空指针 p，else 分支读 p，每条路径上都有报告
+ */
+LLIRModule* createWideModule(int branches) {
+    auto* module = LLIRFactory::createModule("wide");
+    auto* func = LLIRFactory::createFunction("wide");
+    std::vector<LLIRBasicBlock*> heads;
+    for (int i = 0; i <= branches; ++i) {
+        heads.push_back(LLIRFactory::createBasicBlock("h" + std::to_string(i)));
+        func->addBasicBlock(heads.back());
+    }
+    func->setEntryBlock(heads[0]);
+
+    auto* a = LLIRFactory::createArgument("a", ValueType::Integer, 0);
+    for (int i = 0; i < branches; ++i) {
+        auto* thenBlock = LLIRFactory::createBasicBlock("t" + std::to_string(i));
+        auto* elseBlock = LLIRFactory::createBasicBlock("e" + std::to_string(i));
+        func->addBasicBlock(thenBlock);
+        func->addBasicBlock(elseBlock);
+
+        auto* b = LLIRFactory::createArgument("b" + std::to_string(i), ValueType::Integer, i + 1);
+        auto* cond = i % 2 == 0
+            ? LLIRFactory::createICmp(a, LLIRFactory::createIntConstant(3 * i), LLIRCmpPredicate::LT)
+            : LLIRFactory::createICmp(b, LLIRFactory::createIntConstant(i), LLIRCmpPredicate::LT);
+        heads[i]->addInstruction(cond);
+        heads[i]->addInstruction(LLIRFactory::createConditionalBr(cond, thenBlock, elseBlock));
+
+        auto* p = LLIRFactory::createVariable("p", ValueType::Pointer);
+        thenBlock->addInstruction(LLIRFactory::createStore(a, p, at(10 + i, 5)));
+        thenBlock->addInstruction(LLIRFactory::createBr(heads[i + 1]));
+        elseBlock->addInstruction(LLIRFactory::createLoad(p, at(20 + i, 7)));
+        elseBlock->addInstruction(LLIRFactory::createBr(heads[i + 1]));
+    }
+    heads[branches]->addInstruction(LLIRFactory::createRet(nullptr));
+
+    module->addFunction(func);
+    return module;
+}
+
+std::string runWide(int solverThreads, int forkWorkers) {
+    auto* module = createWideModule(8);
+    SymbolicExecutionConfig config;
+    config.deterministic = true;
+    config.solverThreads = solverThreads;
+    config.forkWorkers = forkWorkers;
+    config.maxDepth = 1000;
+    config.maxStates = 2000;
+    SymbolicExecutionEngine engine(module, config);
+    engine.run();
+
+    report::SarifExporter exporter;
+    std::string sarif = exporter.buildSarifLog(engine.getReports());
+    delete module;
+    return sarif;
+}
+
+} // anonymous namespace
+
+/**
+ * @brief 测试1：不同求解线程数得到逐字节相同的 SARIF
+ */
+void testSolverThreads() {
+    std::cout << "=== Test 1: Solver Threads ===" << std::endl;
+
+    std::string sequential = runWide(0, 0);
+    std::string threaded = runWide(2, 0);
+    std::string wider = runWide(4, 0);
+    std::cout << "  SARIF size: " << sequential.size() << " bytes" << std::endl;
+
+    expect(sequential.find("\"ruleId\"") != std::string::npos, "the run reports results");
+    expect(threaded == sequential, "2 solver threads match the sequential run");
+    expect(wider == sequential, "4 solver threads match the sequential run");
+    expect(runWide(2, 0) == threaded, "a repeated run is identical");
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试2：fork 子进程探索子树时结果不变
+ */
+void testForkWorkers() {
+    std::cout << "=== Test 2: Fork Workers ===" << std::endl;
+
+    std::string sequential = runWide(0, 0);
+    expect(runWide(2, 2) == sequential, "2 fork workers match the sequential run");
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试3：fork 子树统计记录按字段名编码
+ */
+void testForkStatsRecord() {
+    std::cout << "=== Test 3: Fork Stats Record ===" << std::endl;
+
+    ForkSubtreeStats stats;
+    stats.counters.paths = 7;
+    stats.counters.prunedPaths = 1;
+    stats.counters.inPlaceForks = 12;
+    stats.states = 40;
+    stats.complete = true;
+    std::string line = stats.encode();
+    std::cout << "  Record: " << line << std::endl;
+
+    ForkSubtreeStats decoded;
+    expect(ForkSubtreeStats::decode(line, decoded), "encoded record decodes");
+    expect(decoded.counters.paths == 7 && decoded.counters.prunedPaths == 1 &&
+           decoded.counters.inPlaceForks == 12 && decoded.states == 40 && decoded.complete,
+           "decoded fields match");
+    expect(ForkSubtreeStats::decode("complete=1 paths=3", decoded) && decoded.counters.paths == 3 &&
+           decoded.states == 0 && decoded.complete, "field order does not matter, missing fields are 0");
+    expect(!ForkSubtreeStats::decode("paths=3 bogus=1", decoded), "unknown field is rejected");
+    expect(!ForkSubtreeStats::decode("paths=x", decoded), "non-numeric value is rejected");
+    expect(!ForkSubtreeStats::decode("3 4 5", decoded), "positional record is rejected");
+
+    ExplorationCounters base;
+    base.paths = 2;
+    base.deadBindings = 5;
+    ExplorationCounters total = base;
+    total += stats.counters;
+    ExplorationCounters delta = total - base;
+    expect(delta.paths == 7 && delta.deadBindings == 0 && delta.inPlaceForks == 12,
+           "counters add and subtract field by field");
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 主函数
+ */
+int main() {
+    std::cout << "CVerifier Deterministic Mode Test Suite" << std::endl;
+    std::cout << "=======================================" << std::endl;
+    std::cout << std::endl;
+
+    utils::Logger::setLevel(utils::Logger::Level::Warning);
+
+    testSolverThreads();
+    testForkWorkers();
+    testForkStatsRecord();
+
+    std::cout << "=======================================" << std::endl;
+    if (failures > 0) {
+        std::cout << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All tests passed!" << std::endl;
+    return 0;
+}
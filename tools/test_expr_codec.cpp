@@ -0,0 +1,159 @@
+/**
+ * @file test_expr_codec.cpp
+ * @brief 表达式二进制编码测试程序
+ */
+
+#include "cverifier/ExprCodec.h"
+#include "cverifier/Utils.h"
+#include <cstdint>
+#include <iostream>
+
+using namespace cverifier;
+using namespace cverifier::core;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << what << std::endl;
+    if (!condition) {
+        ++failures;
+    }
+}
+
+/// 解码端没有对应表达式类的节点
+class BooleanExpr : public Expr {
+public:
+    BooleanExpr() : Expr(ExprType::Boolean, 0) {}
+    std::string toString() const override { return "true"; }
+};
+
+} // anonymous namespace
+
+/**
+ * @brief 测试1：往返编码
+ */
+void testRoundTrip() {
+    std::cout << "=== Test 1: Round Trip ===" << std::endl;
+
+    Expr* x = new VariableExpr("x");
+    Expr* y = new VariableExpr("a_rather_long_variable_name_beyond_sso");
+    Expr* sum = new BinaryOpExpr(BinaryOpType::Add, x, new ConstantExpr(-42));
+    Expr* guard = new BinaryOpExpr(BinaryOpType::LT, sum, y);
+    Expr* select = new IteExpr(guard, new UnaryOpExpr(UnaryOpType::Neg, x), new ConstantExpr(INT64_MIN));
+
+    ExprEncoder encoder;
+    expect(encoder.add(guard) && encoder.add(select), "encoder accepts both roots");
+    std::string data = encoder.finish();
+
+    ExprArena arena;
+    ExprDecoder decoder(arena);
+    std::vector<Expr*> roots;
+    expect(decoder.decode(data, roots), "decoder accepts the encoding");
+    expect(roots.size() == 2, "both roots are decoded");
+    if (roots.size() == 2) {
+        expect(roots[0]->toString() == guard->toString(), "first root prints the same");
+        expect(roots[1]->toString() == select->toString(), "second root prints the same");
+        expect(roots[0]->hash() == guard->hash() && roots[1]->hash() == select->hash(),
+               "decoded roots have the same structural hash");
+        // 第二个根引用第一个根，解码后仍是同一个节点
+        auto* decodedSelect = static_cast<IteExpr*>(roots[1]);
+        expect(decodedSelect->getCondition() == roots[0], "shared condition decodes to one node");
+    }
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试2：共享子表达式只写一次
+ *
+ * e_{i+1} = e_i + e_i：树的大小随深度指数增长，DAG 只有 200 个运算节点
+ */
+void testSharing() {
+    std::cout << "=== Test 2: Sharing ===" << std::endl;
+
+    constexpr int kDepth = 200;
+    Expr* chain = new VariableExpr("x");
+    for (int i = 0; i < kDepth; ++i) {
+        chain = new BinaryOpExpr(BinaryOpType::Add, chain, chain);
+    }
+
+    ExprEncoder encoder;
+    expect(encoder.add(chain), "encoder accepts the doubling chain");
+    expect(encoder.getNumNodes() == kDepth + 1, "one node per distinct expression");
+    std::string data = encoder.finish();
+    std::cout << "  Encoded size: " << data.size() << " bytes" << std::endl;
+    expect(data.size() < 1024, "doubling chain encodes in under 1 KiB");
+
+    ExprArena arena;
+    ExprDecoder decoder(arena);
+    std::vector<Expr*> roots;
+    expect(decoder.decode(data, roots) && roots.size() == 1, "decoder accepts the doubling chain");
+    expect(arena.getNumExprs() == kDepth + 1, "decoder builds one node per encoded node");
+    if (roots.size() == 1) {
+        expect(roots[0]->hash() == chain->hash(), "decoded chain has the same structural hash");
+        bool shared = true;
+        const Expr* node = roots[0];
+        while (node->getType() == ExprType::BinaryOp) {
+            auto* binary = static_cast<const BinaryOpExpr*>(node);
+            shared = shared && binary->getLeft() == binary->getRight();
+            node = binary->getLeft();
+        }
+        expect(shared, "both operands of every level are the same node");
+    }
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试3：不支持的类型在编码时失败，畸形输入在解码时失败
+ */
+void testRejection() {
+    std::cout << "=== Test 3: Rejection ===" << std::endl;
+
+    ExprEncoder encoder;
+    Expr* ok = new BinaryOpExpr(BinaryOpType::Mul, new VariableExpr("n"), new ConstantExpr(4));
+    expect(encoder.add(ok), "supported expression is accepted");
+    Expr* bad = new BinaryOpExpr(BinaryOpType::And, ok, new BooleanExpr());
+    expect(!encoder.add(bad), "unsupported expression type fails at encode time");
+    expect(!encoder.getLastError().empty(), "encoder reports why");
+    expect(encoder.getNumRoots() == 1, "failed root is not added");
+
+    // 失败之后的编码结果仍然可以完整解码
+    std::string data = encoder.finish();
+    ExprArena arena;
+    ExprDecoder decoder(arena);
+    std::vector<Expr*> roots;
+    expect(decoder.decode(data, roots) && roots.size() == 1 && roots[0]->toString() == ok->toString(),
+           "encoding after a failed add still round-trips");
+
+    expect(!decoder.decode(data.substr(0, data.size() - 1), roots), "truncated input is rejected");
+    expect(!decoder.decode(data + '\0', roots), "trailing bytes are rejected");
+    expect(!decoder.decode("CVXF", roots), "wrong magic is rejected");
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 主函数
+ */
+int main() {
+    std::cout << "CVerifier Expression Codec Test Suite" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << std::endl;
+
+    utils::Logger::setLevel(utils::Logger::Level::Warning);
+
+    testRoundTrip();
+    testSharing();
+    testRejection();
+
+    std::cout << "=====================================" << std::endl;
+    if (failures > 0) {
+        std::cout << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All tests passed!" << std::endl;
+    return 0;
+}
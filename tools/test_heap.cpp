@@ -0,0 +1,217 @@
+/**
+ * @file test_heap.cpp
+ * @brief 符号堆与堆指针边界检查测试程序
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/SymbolicState.h"
+#include "cverifier/LLIRFactory.h"
+#include "cverifier/Utils.h"
+#include <iostream>
+
+using namespace cverifier;
+using namespace cverifier::core;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << what << std::endl;
+    if (!condition) {
+        ++failures;
+    }
+}
+
+SourceLocation at(int line) {
+    SourceLocation loc;
+    loc.file = "heap.c";
+    loc.line = line;
+    return loc;
+}
+
+/// 某一行上的缓冲区溢出报告数
+size_t overflowsAt(const SymbolicExecutionEngine& engine, int line) {
+    size_t count = 0;
+    for (const auto& report : engine.getReports()) {
+        if (report.type == VulnerabilityType::BufferOverflow && report.location.line == line) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // anonymous namespace
+
+/**
+ * @brief 测试1：区域索引和堆的复制
+ */
+void testRegionIndex() {
+    std::cout << "=== Test 1: Region Index ===" << std::endl;
+
+    SymbolicHeap heap;
+    Expr* a = heap.allocate(new ConstantExpr(8), at(1));
+    Expr* b = heap.allocate(new ConstantExpr(32), at(2));
+
+    auto inA = heap.resolve(new BinaryOpExpr(BinaryOpType::Add, a, new ConstantExpr(4)));
+    expect(inA.size() == 1 && inA.front()->address == a, "a + 4 resolves to a");
+
+    auto pastA = heap.resolve(new BinaryOpExpr(BinaryOpType::Add, a, new ConstantExpr(8)));
+    expect(pastA.empty(), "a + 8 falls into the red zone");
+
+    auto inB = heap.resolve(new BinaryOpExpr(BinaryOpType::Add, b, new ConstantExpr(31)));
+    expect(inB.size() == 1 && inB.front()->address == b, "b + 31 resolves to b");
+
+    // 符号偏移：[0, 4] 内只可能落在 a 中
+    auto ranged = heap.resolve(new BinaryOpExpr(BinaryOpType::Add, a, new VariableExpr("i")), 0, 4);
+    expect(ranged.size() == 1 && ranged.front()->address == a, "a + i with i in [0, 4] resolves to a");
+
+    // 复制后各自释放，互不影响
+    SymbolicHeap copy = heap;
+    copy.free(a);
+    expect(copy.getUnfreedObjects().size() == 1, "free in the copy releases one object");
+    expect(heap.getUnfreedObjects().size() == 2, "original heap keeps both objects");
+    expect(copy.getFingerprint() != heap.getFingerprint(), "free changes the copy's fingerprint");
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试2：克隆的状态带着堆
+ */
+void testCloneCarriesHeap() {
+    std::cout << "=== Test 2: Clone Carries Heap ===" << std::endl;
+
+    SymbolicState state;
+    Expr* p = state.getHeap()->allocate(new ConstantExpr(16), at(1));
+    auto cloned = state.clone();
+
+    expect(cloned->getHeap()->size() == 1, "clone has the allocated object");
+    expect(cloned->getHeap()->resolve(p).size() == 1, "base pointer resolves in the clone");
+    expect(cloned->getFingerprint() == state.getFingerprint(), "clone has the same fingerprint");
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试3：常量偏移的 base + offset 指针
+ *
+ *   p = malloc(8); p[4] = 1;  // 界内
+ *                  p[8] = 1;  // 越界
+ */
+void testConstantOffsets() {
+    std::cout << "=== Test 3: Constant Offsets ===" << std::endl;
+
+    auto* module = LLIRFactory::createModule("heap");
+    auto* func = LLIRFactory::createFunction("constant_offsets");
+    auto* entry = LLIRFactory::createBasicBlock("entry");
+    func->addBasicBlock(entry);
+    func->setEntryBlock(entry);
+
+    auto* p = LLIRFactory::createCall("malloc", {LLIRFactory::createIntConstant(8)});
+    entry->addInstruction(p);
+    auto* inBounds = LLIRFactory::createGetElementPtr(p, LLIRFactory::createIntConstant(4));
+    entry->addInstruction(inBounds);
+    entry->addInstruction(LLIRFactory::createStore(LLIRFactory::createIntConstant(1), inBounds, at(10)));
+    auto* past = LLIRFactory::createGetElementPtr(p, LLIRFactory::createIntConstant(8));
+    entry->addInstruction(past);
+    entry->addInstruction(LLIRFactory::createStore(LLIRFactory::createIntConstant(1), past, at(11)));
+    entry->addInstruction(LLIRFactory::createRet());
+    module->addFunction(func);
+
+    SymbolicExecutionConfig config;
+    config.solverThreads = 0;
+    SymbolicExecutionEngine engine(module, config);
+    engine.runOnFunction("constant_offsets");
+
+    expect(overflowsAt(engine, 10) == 0, "p[4] is not reported");
+    expect(overflowsAt(engine, 11) == 1, "p[8] is reported");
+
+    delete module;
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试4：路径约束限定的符号偏移
+ *
+ *   p = malloc(8);
+ *   if (n < 8 && n >= 0) p[n] = 1;  // 界内
+ *   else                 p[n] = 1;  // 越界
+ */
+void testSymbolicOffsets() {
+    std::cout << "=== Test 4: Symbolic Offsets ===" << std::endl;
+
+#ifdef HAVE_Z3
+    auto* module = LLIRFactory::createModule("heap");
+    auto* func = LLIRFactory::createFunction("symbolic_offsets");
+    auto block = [&](const std::string& name) {
+        auto* bb = LLIRFactory::createBasicBlock(name);
+        func->addBasicBlock(bb);
+        return bb;
+    };
+    auto* entry = block("entry");
+    auto* check = block("check");
+    auto* guarded = block("guarded");
+    auto* unguarded = block("unguarded");
+    func->setEntryBlock(entry);
+
+    auto* n = LLIRFactory::createArgument("n", ValueType::Integer, 0);
+    auto* p = LLIRFactory::createCall("malloc", {LLIRFactory::createIntConstant(8)});
+    entry->addInstruction(p);
+    auto* below = LLIRFactory::createICmp(n, LLIRFactory::createIntConstant(8), LLIRCmpPredicate::LT);
+    entry->addInstruction(below);
+    entry->addInstruction(LLIRFactory::createConditionalBr(below, check, unguarded));
+
+    auto* nonNegative = LLIRFactory::createICmp(n, LLIRFactory::createIntConstant(0), LLIRCmpPredicate::GE);
+    check->addInstruction(nonNegative);
+    check->addInstruction(LLIRFactory::createConditionalBr(nonNegative, guarded, unguarded));
+
+    auto* inBounds = LLIRFactory::createGetElementPtr(p, n);
+    guarded->addInstruction(inBounds);
+    guarded->addInstruction(LLIRFactory::createStore(LLIRFactory::createIntConstant(1), inBounds, at(20)));
+    guarded->addInstruction(LLIRFactory::createRet());
+
+    auto* outOfBounds = LLIRFactory::createGetElementPtr(p, n);
+    unguarded->addInstruction(outOfBounds);
+    unguarded->addInstruction(LLIRFactory::createStore(LLIRFactory::createIntConstant(1), outOfBounds, at(21)));
+    unguarded->addInstruction(LLIRFactory::createRet());
+    module->addFunction(func);
+
+    SymbolicExecutionConfig config;
+    config.solverThreads = 0;
+    SymbolicExecutionEngine engine(module, config);
+    engine.runOnFunction("symbolic_offsets");
+
+    expect(overflowsAt(engine, 20) == 0, "p[n] with 0 <= n < 8 is not reported");
+    expect(overflowsAt(engine, 21) > 0, "p[n] without the guard is reported");
+
+    delete module;
+#else
+    std::cout << "Z3 not available, skipping test" << std::endl;
+#endif
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 主函数
+ */
+int main() {
+    std::cout << "CVerifier Symbolic Heap Test Suite" << std::endl;
+    std::cout << "==================================" << std::endl;
+    std::cout << std::endl;
+
+    utils::Logger::setLevel(utils::Logger::Level::Warning);
+
+    testRegionIndex();
+    testCloneCarriesHeap();
+    testConstantOffsets();
+    testSymbolicOffsets();
+
+    std::cout << "==================================" << std::endl;
+    if (failures > 0) {
+        std::cout << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All tests passed!" << std::endl;
+    return 0;
+}
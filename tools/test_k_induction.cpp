@@ -0,0 +1,223 @@
+/**
+ * @file test_k_induction.cpp
+ * @brief k-归纳证明与有界模型检查测试程序
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/LLIRFactory.h"
+#include "cverifier/Utils.h"
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <utility>
+
+using namespace cverifier;
+using namespace cverifier::core;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << what << std::endl;
+    if (!condition) {
+        ++failures;
+    }
+}
+
+SourceLocation at(int line) {
+    SourceLocation loc;
+    loc.file = "k.c";
+    loc.line = line;
+    loc.column = 1;
+    return loc;
+}
+
+/// 第 99 行的解引用只在 flag == 0 时执行，而循环体每次都先把 flag 置 1
+constexpr int kUnreachableLine = 99;
+
+/**
+ * @brief 带不可达检查点的循环
+ *
+ *   for (i = 0; i < n; i++) {
+ *       flag = 1;
+ *       if (flag == 0) *q;      // 第 99 行，不可达
+ *   }
+ */
+LLIRModule* createLoopModule() {
+    auto* module = LLIRFactory::createModule("k");
+    auto* func = LLIRFactory::createFunction("k");
+    auto block = [&](const std::string& name) {
+        auto* bb = LLIRFactory::createBasicBlock(name);
+        func->addBasicBlock(bb);
+        return bb;
+    };
+    auto* entry = block("entry");
+    auto* cond = block("cond");
+    auto* body = block("body");
+    auto* bad = block("bad");
+    auto* inc = block("inc");
+    auto* end = block("end");
+    func->setEntryBlock(entry);
+
+    auto i = []() { return LLIRFactory::createVariable("i", ValueType::Integer, 0); };
+    auto flag = []() { return LLIRFactory::createVariable("flag", ValueType::Integer, 0); };
+    auto* n = LLIRFactory::createArgument("n", ValueType::Integer, 0);
+    auto* q = LLIRFactory::createArgument("q", ValueType::Pointer, 1);
+
+    entry->addInstruction(LLIRFactory::createStore(LLIRFactory::createIntConstant(0), i(), at(1)));
+    entry->addInstruction(LLIRFactory::createBr(cond));
+
+    auto* index = LLIRFactory::createLoad(i(), at(2));
+    cond->addInstruction(index);
+    auto* below = LLIRFactory::createICmp(index, n, LLIRCmpPredicate::LT);
+    cond->addInstruction(below);
+    cond->addInstruction(LLIRFactory::createConditionalBr(below, body, end));
+
+    body->addInstruction(LLIRFactory::createStore(LLIRFactory::createIntConstant(1), flag(), at(3)));
+    auto* current = LLIRFactory::createLoad(flag(), at(4));
+    body->addInstruction(current);
+    auto* cleared = LLIRFactory::createICmp(current, LLIRFactory::createIntConstant(0), LLIRCmpPredicate::EQ);
+    body->addInstruction(cleared);
+    body->addInstruction(LLIRFactory::createConditionalBr(cleared, bad, inc));
+
+    bad->addInstruction(LLIRFactory::createLoad(q, at(kUnreachableLine)));
+    bad->addInstruction(LLIRFactory::createBr(inc));
+
+    auto* counter = LLIRFactory::createLoad(i(), at(5));
+    inc->addInstruction(counter);
+    auto* next = LLIRFactory::createAdd(counter, LLIRFactory::createIntConstant(1));
+    inc->addInstruction(next);
+    inc->addInstruction(LLIRFactory::createStore(next, i(), at(6)));
+    inc->addInstruction(LLIRFactory::createBr(cond));
+
+    end->addInstruction(LLIRFactory::createRet(nullptr));
+
+    module->addFunction(func);
+    return module;
+}
+
+struct RunResult {
+    size_t states = 0;
+    size_t proven = 0;
+    std::set<std::pair<int, VulnerabilityType>> findings;  ///< 按（行号，类型）去重的报告
+};
+
+/// 统计信息中某一行的数值（不存在时为 0）
+size_t parseStatistic(const std::string& statistics, const std::string& label) {
+    size_t pos = statistics.find("  " + label + ": ");
+    if (pos == std::string::npos) {
+        return 0;
+    }
+    std::istringstream iss(statistics.substr(pos + label.size() + 4));
+    size_t value = 0;
+    iss >> value;
+    return value;
+}
+
+RunResult runLoop(int kInduction, bool goalTermination, int bmcBound) {
+    auto* module = createLoopModule();
+    SymbolicExecutionConfig config;
+    config.solverThreads = 0;
+    config.enableLoopAcceleration = false;
+    config.maxDepth = 60;
+    config.kInduction = kInduction;
+    config.enableGoalTermination = goalTermination;
+    config.bmcBound = bmcBound;
+    SymbolicExecutionEngine engine(module, config);
+    engine.run();
+
+    RunResult result;
+    std::string statistics = engine.getStatistics();
+    result.states = parseStatistic(statistics, "Reached States");
+    result.proven = parseStatistic(statistics, "Proven Safe");
+    for (const auto& report : engine.getReports()) {
+        result.findings.emplace(report.location.line, report.type);
+    }
+    delete module;
+    return result;
+}
+
+bool reportsLine(const RunResult& result, int line) {
+    for (const auto& finding : result.findings) {
+        if (finding.first == line) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+/**
+ * @brief 测试1：k-归纳证明不可达的检查点
+ */
+void testInduction() {
+    std::cout << "=== Test 1: k-Induction ===" << std::endl;
+
+#ifdef HAVE_Z3
+    RunResult baseline = runLoop(0, false, 0);
+    RunResult proved = runLoop(1, false, 0);
+    RunResult early = runLoop(1, true, 0);
+    std::cout << "  Baseline:             " << baseline.states << " states, "
+              << baseline.findings.size() << " findings" << std::endl;
+    std::cout << "  k = 1:                " << proved.states << " states, "
+              << proved.proven << " proven" << std::endl;
+    std::cout << "  k = 1, goal-directed: " << early.states << " states, "
+              << early.findings.size() << " findings" << std::endl;
+
+    expect(!baseline.findings.empty(), "baseline reports the reachable sites");
+    expect(!reportsLine(baseline, kUnreachableLine), "baseline does not report the unreachable site");
+    expect(proved.proven == 1, "k = 1 proves exactly one site safe");
+    expect(proved.findings == baseline.findings, "k = 1 keeps the baseline findings");
+    expect(early.findings == baseline.findings, "goal-directed k = 1 keeps the baseline findings");
+    expect(early.states <= 5 && baseline.states > 10 * early.states,
+           "goal-directed k = 1 stops after a handful of states");
+#else
+    std::cout << "Z3 not available, skipping test" << std::endl;
+#endif
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试2：有界模型检查的结论与路径探索一致
+ */
+void testBoundedModelChecking() {
+    std::cout << "=== Test 2: Bounded Model Checking ===" << std::endl;
+
+#ifdef HAVE_Z3
+    RunResult baseline = runLoop(0, false, 0);
+    RunResult bounded = runLoop(0, false, 5);
+    RunResult combined = runLoop(1, true, 5);
+    std::cout << "  BMC findings: " << bounded.findings.size() << std::endl;
+
+    expect(bounded.findings == baseline.findings, "BMC with bound 5 finds the same sites");
+    expect(!reportsLine(bounded, kUnreachableLine), "BMC does not report the unreachable site");
+    expect(combined.findings == baseline.findings, "BMC with k-induction finds the same sites");
+#else
+    std::cout << "Z3 not available, skipping test" << std::endl;
+#endif
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 主函数
+ */
+int main() {
+    std::cout << "CVerifier k-Induction Test Suite" << std::endl;
+    std::cout << "================================" << std::endl;
+    std::cout << std::endl;
+
+    utils::Logger::setLevel(utils::Logger::Level::Warning);
+
+    testInduction();
+    testBoundedModelChecking();
+
+    std::cout << "================================" << std::endl;
+    if (failures > 0) {
+        std::cout << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file test_loop_acceleration.cpp
+ * @brief 计数循环加速测试程序
+ */
+
+#include "cverifier/SymbolicExecutionEngine.h"
+#include "cverifier/LLIRFactory.h"
+#include "cverifier/Utils.h"
+#include <iostream>
+#include <sstream>
+
+using namespace cverifier;
+using namespace cverifier::core;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << what << std::endl;
+    if (!condition) {
+        ++failures;
+    }
+}
+
+/**
+ * @brief 缓冲区填充循环
+ *
+ *   for (i = 0; i < n; i++) buf[i] = 0;
+ *   if (i == -3) return i; else return i;   // 循环结束后 i >= 0，前一个分支不可行
+ */
+LLIRModule* createFillModule() {
+    auto* module = LLIRFactory::createModule("loop");
+    auto* func = LLIRFactory::createFunction("fill");
+    auto block = [&](const std::string& name) {
+        auto* bb = LLIRFactory::createBasicBlock(name);
+        func->addBasicBlock(bb);
+        return bb;
+    };
+    auto* entry = block("entry");
+    auto* cond = block("for.cond");
+    auto* body = block("for.body");
+    auto* inc = block("for.inc");
+    auto* end = block("for.end");
+    auto* negative = block("negative");
+    auto* other = block("other");
+    func->setEntryBlock(entry);
+
+    auto i = []() { return LLIRFactory::createVariable("i", ValueType::Integer, 0); };
+    auto* n = LLIRFactory::createArgument("n", ValueType::Integer, 0);
+    auto* buf = LLIRFactory::createArgument("buf", ValueType::Pointer, 1);
+
+    entry->addInstruction(LLIRFactory::createStore(LLIRFactory::createIntConstant(0), i()));
+    entry->addInstruction(LLIRFactory::createBr(cond));
+
+    auto* index = LLIRFactory::createLoad(i());
+    cond->addInstruction(index);
+    auto* below = LLIRFactory::createICmp(index, n, LLIRCmpPredicate::LT);
+    cond->addInstruction(below);
+    cond->addInstruction(LLIRFactory::createConditionalBr(below, body, end));
+
+    auto* element = LLIRFactory::createLoad(i());
+    body->addInstruction(element);
+    auto* slot = LLIRFactory::createGetElementPtr(buf, element);
+    body->addInstruction(slot);
+    body->addInstruction(LLIRFactory::createStore(LLIRFactory::createIntConstant(0), slot));
+    body->addInstruction(LLIRFactory::createBr(inc));
+
+    auto* current = LLIRFactory::createLoad(i());
+    inc->addInstruction(current);
+    auto* next = LLIRFactory::createAdd(current, LLIRFactory::createIntConstant(1));
+    inc->addInstruction(next);
+    inc->addInstruction(LLIRFactory::createStore(next, i()));
+    inc->addInstruction(LLIRFactory::createBr(cond));
+
+    auto* result = LLIRFactory::createLoad(i());
+    end->addInstruction(result);
+    auto* isNegative = LLIRFactory::createICmp(result, LLIRFactory::createIntConstant(-3), LLIRCmpPredicate::EQ);
+    end->addInstruction(isNegative);
+    end->addInstruction(LLIRFactory::createConditionalBr(isNegative, negative, other));
+    negative->addInstruction(LLIRFactory::createRet(result));
+    other->addInstruction(LLIRFactory::createRet(result));
+
+    module->addFunction(func);
+    return module;
+}
+
+struct RunResult {
+    int paths = 0;
+    size_t states = 0;
+    size_t queries = 0;
+};
+
+/// 求解流水线提交的查询数（来自统计信息的 "Queries:" 行，没有流水线时为 0）
+size_t parseQueries(const std::string& statistics) {
+    const std::string label = "  Queries: ";
+    size_t pos = statistics.find(label);
+    if (pos == std::string::npos) {
+        return 0;
+    }
+    std::istringstream iss(statistics.substr(pos + label.size()));
+    size_t queries = 0;
+    iss >> queries;
+    return queries;
+}
+
+RunResult runFill(bool accelerate, int solverThreads) {
+    auto* module = createFillModule();
+    SymbolicExecutionConfig config;
+    config.solverThreads = solverThreads;
+    config.enableLoopAcceleration = accelerate;
+    config.retainReachedStates = true;
+    SymbolicExecutionEngine engine(module, config);
+    engine.run();
+
+    RunResult result;
+    result.paths = engine.getExploredPaths();
+    result.states = engine.getReachedStates().size();
+    result.queries = parseQueries(engine.getStatistics());
+    delete module;
+    return result;
+}
+
+} // anonymous namespace
+
+/**
+ * @brief 测试1：加速后循环只展开一次
+ */
+void testExploration() {
+    std::cout << "=== Test 1: Exploration ===" << std::endl;
+
+    RunResult accelerated = runFill(true, 0);
+    RunResult unrolled = runFill(false, 0);
+    std::cout << "  Accelerated: " << accelerated.paths << " paths, " << accelerated.states << " states" << std::endl;
+    std::cout << "  Unrolled:    " << unrolled.paths << " paths, " << unrolled.states << " states" << std::endl;
+
+    expect(accelerated.paths == 1, "accelerated loop explores one path");
+    expect(accelerated.states <= 4, "accelerated loop reaches a handful of states");
+    expect(unrolled.paths > 10 * accelerated.paths, "unrolling explores many more paths");
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 测试2：求解器查询数
+ *
+ * 加速后只剩循环体状态、循环出口和 i == -3 分支的查询
+ */
+void testQueryCount() {
+    std::cout << "=== Test 2: Query Count ===" << std::endl;
+
+#ifdef HAVE_Z3
+    RunResult accelerated = runFill(true, 2);
+    RunResult unrolled = runFill(false, 2);
+    std::cout << "  Accelerated: " << accelerated.queries << " queries" << std::endl;
+    std::cout << "  Unrolled:    " << unrolled.queries << " queries" << std::endl;
+
+    expect(accelerated.queries > 0 && accelerated.queries <= 3, "accelerated loop needs at most 3 queries");
+    expect(unrolled.queries >= 10 * accelerated.queries, "unrolling needs at least 10x as many queries");
+#else
+    std::cout << "Z3 not available, skipping test" << std::endl;
+#endif
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 主函数
+ */
+int main() {
+    std::cout << "CVerifier Loop Acceleration Test Suite" << std::endl;
+    std::cout << "======================================" << std::endl;
+    std::cout << std::endl;
+
+    utils::Logger::setLevel(utils::Logger::Level::Warning);
+
+    testExploration();
+    testQueryCount();
+
+    std::cout << "======================================" << std::endl;
+    if (failures > 0) {
+        std::cout << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All tests passed!" << std::endl;
+    return 0;
+}
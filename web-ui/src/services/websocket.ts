@@ -22,9 +22,22 @@ export interface ProgressMessage {
     message: string
     filesAnalyzed: number
     totalFiles: number
+    engine?: EngineProgress
   }
 }
 
+export interface EngineProgress {
+  function: string
+  functionsCompleted: number
+  totalFunctions: number
+  statesPerSec: number
+  frontierSize: number
+  coverage: number
+  exploredPaths: number
+  reachedStates: number
+  reportsFound: number
+}
+
 export interface LogMessage {
   type: 'log'
   taskId: string